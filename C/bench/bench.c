@@ -0,0 +1,808 @@
+// Decoding benchmark. Times every sample rate, channel config and superframe
+// size on generated streams, then any AT9 files given on the command line,
+// then the Dct4, ReadSpectra and band extension kernels on their own.
+// Built by "make bench" with ATRAC9_PROFILE, so per-stage ticks are shown.
+// With --fixed as the first argument, the same streams are instead decoded
+// in both fixed point and double, and the PCM differences are tallied.
+#define _POSIX_C_SOURCE 199309L
+
+#include "band_extension.h"
+#include "decinit.h"
+#include "decoder.h"
+#include "dispatch.h"
+#include "tables.h"
+#include "unpack.h"
+#include "utility.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCH_SECONDS 0.02
+#define MICRO_SECONDS 0.1
+#define SYNTHETIC_FRAMES 64
+#define SYNTHETIC_FRAME_BYTES 2048
+#define BLOCK_ATTEMPTS 64
+#define FRAME_ATTEMPTS 64
+// The bit reader may look a few bytes past the last field it reads
+#define BUFFER_PADDING 16
+// The last bucket counts every difference that large or larger
+#define ERROR_BUCKETS 8
+
+typedef struct {
+	unsigned char Config[CONFIG_DATA_SIZE];
+	unsigned char* Data;
+	int SuperframeCount;
+} Stream;
+
+typedef struct {
+	unsigned char* Buffer;
+	int Position;
+} BitWriterCxt;
+
+typedef struct {
+	long long Samples;
+	long long Histogram[ERROR_BUCKETS];
+	int MaxError;
+} ErrorStats;
+
+static double Now(void);
+static int Random(int range);
+static void WriteBits(BitWriterCxt* bw, int value, int bits);
+static void FillRandom(BitWriterCxt* bw, int endByte);
+
+static void MakeConfig(unsigned char* config, int sampleRateIndex, int channelConfigIndex, int superframeIndex, int frameBytes);
+static int GenerateStream(Stream* stream, int sampleRateIndex, int channelConfigIndex, int superframeIndex, int frameCount);
+static int WriteFrame(Atrac9Handle* handle, Atrac9Handle* saved, unsigned char* frame, int capacity);
+static void WriteBlockSideInfo(BitWriterCxt* bw, Block* block, int first);
+static void WriteBandParams(BitWriterCxt* bw, Block* block, int* quantUnits, int* stereoUnit, int* extension, int* extensionUnit);
+static void WriteGradientParams(BitWriterCxt* bw, int quantUnits);
+static void WriteExtensionParams(BitWriterCxt* bw, Block* block, int quantUnits);
+static void WriteScaleFactorsHeader(BitWriterCxt* bw, int first, int extensionUnit);
+static int TryBlock(Atrac9Handle* handle, Atrac9Handle* saved, const unsigned char* frame, int blockIndex);
+
+static int LoadAt9File(const char* path, Stream* stream);
+static At9Status DecodeStream(Atrac9Handle* handle, const Stream* stream, short* pcm);
+static void BenchStream(const char* name, const Stream* stream);
+static void CompareFixedPoint(const char* name, const Stream* stream, ErrorStats* total);
+static At9Status CompareStreamPcm(Atrac9Handle* handle, Atrac9Handle* fixedHandle, const Stream* stream, ErrorStats* stats);
+static void PrintErrorStats(const char* name, const ErrorStats* stats);
+
+static void BenchDct4(int bits);
+static void BenchReadSpectra(int sampleRateIndex);
+static void BenchBandExtension(void);
+
+static unsigned long long RandomState = 0x9E3779B97F4A7C15ULL;
+
+int main(int argc, char** argv)
+{
+	static const char* levelNames[] = { "generic", "sse41", "avx2", "avx512" };
+	const int fixed = argc > 1 && strcmp(argv[1], "--fixed") == 0;
+	ErrorStats total;
+	Stream stream;
+
+	InitTables();
+	memset(&total, 0, sizeof(total));
+	printf("Kernels: %s\n\n", levelNames[Kernels.Level]);
+
+	if (fixed)
+	{
+		printf("%-24s %10s %9s %5s", "stream", "samples", "same %", "max");
+		for (int i = 0; i < ERROR_BUCKETS; i++)
+		{
+			printf(" %7d%s", i, i == ERROR_BUCKETS - 1 ? "+" : " ");
+		}
+		printf("\n");
+	}
+	else
+	{
+		printf("%-24s %10s %9s %9s %9s %9s %9s %9s\n", "stream", "frames/s", "ns/smpl", "unpack", "dequant", "bex", "imdct", "pcm");
+	}
+
+	for (int sampleRate = 0; sampleRate < 16; sampleRate++)
+	{
+		for (int channelConfig = 0; channelConfig < 6; channelConfig++)
+		{
+			for (int superframe = 0; superframe < 4; superframe++)
+			{
+				char name[32];
+				snprintf(name, sizeof(name), "%dHz cfg%d x%d", SampleRates[sampleRate], channelConfig, 1 << superframe);
+
+				if (!GenerateStream(&stream, sampleRate, channelConfig, superframe, SYNTHETIC_FRAMES))
+				{
+					printf("%-24s generation failed\n", name);
+					continue;
+				}
+
+				if (fixed) CompareFixedPoint(name, &stream, &total);
+				else BenchStream(name, &stream);
+				free(stream.Data);
+			}
+		}
+	}
+
+	for (int i = 1 + fixed; i < argc; i++)
+	{
+		if (!LoadAt9File(argv[i], &stream))
+		{
+			printf("%-24s not an AT9 file\n", argv[i]);
+			continue;
+		}
+
+		if (fixed) CompareFixedPoint(argv[i], &stream, &total);
+		else BenchStream(argv[i], &stream);
+		free(stream.Data);
+	}
+
+	if (fixed)
+	{
+		printf("\n");
+		PrintErrorStats("all streams", &total);
+		printf("\nColumns after max count samples by their difference in LSBs.\n");
+		return 0;
+	}
+
+	printf("\nStage columns are profiling ticks per frame.\n\n");
+
+	for (int bits = 6; bits <= 8; bits++)
+	{
+		BenchDct4(bits);
+	}
+	BenchReadSpectra(7);
+	BenchReadSpectra(12);
+	BenchBandExtension();
+
+	return 0;
+}
+
+static double Now(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart / frequency.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec * 1e-9;
+#endif
+}
+
+// xorshift64, seeded the same on every run so the streams are reproducible
+static int Random(int range)
+{
+	RandomState ^= RandomState << 13;
+	RandomState ^= RandomState >> 7;
+	RandomState ^= RandomState << 17;
+	return (int)((RandomState >> 32) % (unsigned int)range);
+}
+
+static void WriteBits(BitWriterCxt* bw, int value, int bits)
+{
+	for (int i = bits - 1; i >= 0; i--)
+	{
+		unsigned char* byte = &bw->Buffer[bw->Position / 8];
+		const int shift = 7 - bw->Position % 8;
+		*byte = (unsigned char)((*byte & ~(1 << shift)) | ((value >> i) & 1) << shift);
+		bw->Position++;
+	}
+}
+
+// Fills from the current position up to endByte without moving the position
+static void FillRandom(BitWriterCxt* bw, int endByte)
+{
+	const int position = bw->Position;
+	WriteBits(bw, Random(256), (8 - position % 8) % 8);
+
+	for (int i = bw->Position / 8; i < endByte; i++)
+	{
+		bw->Buffer[i] = (unsigned char)Random(256);
+	}
+
+	bw->Position = position;
+}
+
+static void MakeConfig(unsigned char* config, int sampleRateIndex, int channelConfigIndex, int superframeIndex, int frameBytes)
+{
+	config[0] = 0xFE;
+	config[1] = (unsigned char)(sampleRateIndex << 4 | channelConfigIndex << 1);
+	config[2] = (unsigned char)((frameBytes - 1) >> 3);
+	config[3] = (unsigned char)(((frameBytes - 1) & 7) << 5 | superframeIndex << 3);
+}
+
+// Each frame is built a block at a time. The side info is written field by
+// field with values the decoder accepts, and everything after it is random.
+// Unpacking the frame so far then tells where the block's spectra ended.
+static int GenerateStream(Stream* stream, int sampleRateIndex, int channelConfigIndex, int superframeIndex, int frameCount)
+{
+	Atrac9Handle* handle = calloc(1, sizeof(Atrac9Handle));
+	Atrac9Handle* saved = malloc(sizeof(Atrac9Handle));
+	int success = TRUE;
+
+	MakeConfig(stream->Config, sampleRateIndex, channelConfigIndex, superframeIndex, SYNTHETIC_FRAME_BYTES);
+	RandomState ^= (unsigned long long)(sampleRateIndex * 131 + channelConfigIndex * 17 + superframeIndex * 7 + 1) * 0x9E3779B97F4A7C15ULL;
+
+	if (handle == NULL || saved == NULL || InitDecoder(handle, stream->Config, 16) != ERR_SUCCESS)
+	{
+		free(handle);
+		free(saved);
+		return FALSE;
+	}
+
+	const int framesPerSuperframe = handle->Config.FramesPerSuperframe;
+	const int superframeBytes = handle->Config.SuperframeBytes;
+	stream->SuperframeCount = (frameCount + framesPerSuperframe - 1) / framesPerSuperframe;
+	stream->Data = calloc(stream->SuperframeCount * superframeBytes + BUFFER_PADDING, 1);
+
+	for (int s = 0; s < stream->SuperframeCount && success && stream->Data; s++)
+	{
+		unsigned char* frame = stream->Data + s * superframeBytes;
+
+		for (int f = 0; f < framesPerSuperframe; f++)
+		{
+			const int frameBytes = WriteFrame(handle, saved, frame, SYNTHETIC_FRAME_BYTES);
+			if (frameBytes < 0)
+			{
+				success = FALSE;
+				break;
+			}
+			frame += frameBytes;
+		}
+	}
+
+	success &= stream->Data != NULL;
+	if (!success) free(stream->Data);
+
+	free(handle);
+	free(saved);
+	return success;
+}
+
+// Returns the frame's size in bytes, or -1 if no frame that fits was found.
+// On success the handle has unpacked the frame, ready for the next one.
+static int WriteFrame(Atrac9Handle* handle, Atrac9Handle* saved, unsigned char* frame, int capacity)
+{
+	const int blockCount = handle->Config.ChannelConfig.BlockCount;
+	const int first = handle->Frame.IndexInSuperframe == 0;
+
+	for (int attempt = 0; attempt < FRAME_ATTEMPTS; attempt++)
+	{
+		BitWriterCxt bw = { frame, 0 };
+		int block;
+
+		for (block = 0; block < blockCount; block++)
+		{
+			const int start = bw.Position;
+			int bitCount = -1;
+
+			for (int i = 0; i < BLOCK_ATTEMPTS && bitCount < 0; i++)
+			{
+				bw.Position = start;
+				WriteBlockSideInfo(&bw, &handle->Frame.Blocks[block], first);
+				FillRandom(&bw, capacity);
+				bitCount = TryBlock(handle, saved, frame, block);
+
+				if (start + bitCount > (capacity - BUFFER_PADDING) * 8) bitCount = -1;
+			}
+
+			if (bitCount < 0) break;
+			bw.Position = start + bitCount;
+		}
+
+		if (block < blockCount) continue;
+
+		BitReaderCxt br;
+		InitBitReaderCxt(&br, frame);
+		if (UnpackFrame(&handle->Frame, &br) != ERR_SUCCESS) break;
+
+		return bw.Position / 8;
+	}
+
+	return -1;
+}
+
+static void WriteBlockSideInfo(BitWriterCxt* bw, Block* block, int first)
+{
+	int quantUnits, stereoUnit, extension, extensionUnit;
+
+	WriteBits(bw, !first, 1);
+
+	if (block->BlockType == LFE)
+	{
+		WriteBits(bw, Random(2), 1);
+		return;
+	}
+
+	const int reuse = !first && Random(4) == 0;
+	WriteBits(bw, reuse, 1);
+
+	if (reuse)
+	{
+		quantUnits = block->QuantizationUnitCount;
+		stereoUnit = block->StereoQuantizationUnit;
+		extension = block->BandExtensionEnabled;
+		extensionUnit = block->ExtensionUnit;
+	}
+	else
+	{
+		WriteBandParams(bw, block, &quantUnits, &stereoUnit, &extension, &extensionUnit);
+	}
+
+	WriteGradientParams(bw, quantUnits);
+
+	if (block->BlockType == Stereo)
+	{
+		const int jointStereoSigns = Random(2);
+		WriteBits(bw, Random(2), 1);
+		WriteBits(bw, jointStereoSigns, 1);
+		for (int i = stereoUnit; jointStereoSigns && i < quantUnits; i++)
+		{
+			WriteBits(bw, Random(2), 1);
+		}
+	}
+
+	if (extension)
+	{
+		WriteExtensionParams(bw, block, quantUnits);
+	}
+	else
+	{
+		WriteBits(bw, 0, 1);
+	}
+
+	WriteScaleFactorsHeader(bw, first, extensionUnit);
+}
+
+// Band extension is only enabled where BexGroupInfo has an entry
+static void WriteBandParams(BitWriterCxt* bw, Block* block, int* quantUnits, int* stereoUnit, int* extension, int* extensionUnit)
+{
+	const ConfigData* config = block->Config;
+	const int minBandCount = MinBandCount[config->HighSampleRate];
+	const int bandCount = minBandCount + Random(MaxBandCount[config->SampleRateIndex] - minBandCount + 1);
+	int stereoBand = bandCount;
+
+	*quantUnits = BandToQuantUnitCount[bandCount];
+	WriteBits(bw, bandCount - minBandCount, 4);
+
+	if (block->BlockType == Stereo)
+	{
+		stereoBand = minBandCount + Random(bandCount - minBandCount + 1);
+		WriteBits(bw, stereoBand - minBandCount, 4);
+	}
+	*stereoUnit = BandToQuantUnitCount[stereoBand];
+
+	*extension = *quantUnits >= 13 && *quantUnits <= 20 && Random(2);
+	WriteBits(bw, *extension, 1);
+	*extensionUnit = *quantUnits;
+
+	if (*extension)
+	{
+		const int extensionBand = bandCount + Random(MaxExtensionBand[config->HighSampleRate] - bandCount + 1);
+		WriteBits(bw, extensionBand - minBandCount, 4);
+		*extensionUnit = BandToQuantUnitCount[extensionBand];
+	}
+}
+
+// Gradient values of at least 4 keep the fine precisions within 16 bits
+static void WriteGradientParams(BitWriterCxt* bw, int quantUnits)
+{
+	const int mode = Random(4);
+	WriteBits(bw, mode, 2);
+
+	if (mode > 0)
+	{
+		WriteBits(bw, Random(32), 5);
+		WriteBits(bw, Random(32), 5);
+	}
+	else
+	{
+		const int startUnit = Random(quantUnits);
+		const int endUnit = startUnit + 1 + Random(31 - startUnit);
+		WriteBits(bw, startUnit, 6);
+		WriteBits(bw, endUnit - 1, 6);
+		WriteBits(bw, 4 + Random(16), 5);
+		WriteBits(bw, 4 + Random(16), 5);
+	}
+
+	WriteBits(bw, Random(Min(quantUnits, 15) + 1), 4);
+}
+
+static void WriteExtensionParams(BitWriterCxt* bw, Block* block, int quantUnits)
+{
+	const int bexBand = BexGroupInfo[quantUnits - 13].BandCount;
+	const int bexMode = Random(4);
+	int dataLength = 0;
+
+	if (block->BlockType == Stereo)
+	{
+		const int mode = Random(4);
+		WriteBits(bw, mode, 2);
+
+		for (int i = 0; i < BexEncodedValueCounts[bexBand > 2 ? mode : 4][bexBand]; i++)
+		{
+			dataLength += BexDataLengths[bexBand > 2 ? mode : 4][bexBand][i];
+		}
+	}
+	else
+	{
+		WriteBits(bw, 0, 1);
+	}
+
+	WriteBits(bw, 1, 1);
+	WriteBits(bw, bexMode, 2);
+
+	for (int i = 0; i < BexEncodedValueCounts[bexBand > 2 ? bexMode : 4][bexBand]; i++)
+	{
+		dataLength += BexDataLengths[bexBand > 2 ? bexMode : 4][bexBand][i];
+	}
+
+	// The values themselves are left to the random fill
+	WriteBits(bw, dataLength, 5);
+}
+
+// The first channel's scale factors are either fixed-length offsets or
+// distances to the previous frame's, which are always in range. The
+// second channel's are left to the random fill, so its block may be retried.
+static void WriteScaleFactorsHeader(BitWriterCxt* bw, int first, int extensionUnit)
+{
+	if (first || Random(2))
+	{
+		WriteBits(bw, 1, 2);
+		WriteBits(bw, 0, 2);
+		WriteBits(bw, 8 + Random(17), 5);
+		for (int i = 0; i < extensionUnit; i++)
+		{
+			WriteBits(bw, Random(4), 2);
+		}
+	}
+	else
+	{
+		WriteBits(bw, 2, 2);
+	}
+}
+
+// Unpacks the frame up to and including blockIndex, then puts the handle's
+// state back. The random bits after the block are never unpacked, as the
+// decoder doesn't check every field of a block for consistency. Returns the
+// block's length in bits, or -1 if it's invalid.
+static int TryBlock(Atrac9Handle* handle, Atrac9Handle* saved, const unsigned char* frame, int blockIndex)
+{
+	BitReaderCxt br;
+	InitBitReaderCxt(&br, frame);
+
+	memcpy(saved, handle, sizeof(Atrac9Handle));
+	handle->Config.ChannelConfig.BlockCount = (unsigned char)(blockIndex + 1);
+	handle->Frame.Blocks[blockIndex].BitCount = -1;
+	UnpackFrame(&handle->Frame, &br);
+	const int bitCount = handle->Frame.Blocks[blockIndex].BitCount;
+	memcpy(handle, saved, sizeof(Atrac9Handle));
+
+	return bitCount;
+}
+
+static unsigned int ReadLittleEndian32(const unsigned char* data)
+{
+	return data[0] | data[1] << 8 | data[2] << 16 | (unsigned int)data[3] << 24;
+}
+
+// Finds the config data and the audio the same way Atrac9DecodeBuffer does
+static int LoadAt9File(const char* path, Stream* stream)
+{
+	FILE* file = fopen(path, "rb");
+	const unsigned char* config = NULL;
+	const unsigned char* data = NULL;
+	unsigned int dataSize = 0;
+
+	if (file == NULL) return FALSE;
+	fseek(file, 0, SEEK_END);
+	const long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	unsigned char* buffer = malloc(size + BUFFER_PADDING);
+	if (buffer == NULL || size < 12 || fread(buffer, 1, size, file) != (size_t)size ||
+		memcmp(buffer, "RIFF", 4) != 0 || memcmp(buffer + 8, "WAVE", 4) != 0)
+	{
+		fclose(file);
+		free(buffer);
+		return FALSE;
+	}
+	fclose(file);
+
+	for (long position = 12; position + 8 <= size; )
+	{
+		const unsigned char* chunk = buffer + position;
+		const unsigned int chunkSize = ReadLittleEndian32(chunk + 4);
+
+		if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize == 0x34)
+		{
+			config = chunk + 0x34;
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			data = chunk + 8;
+			dataSize = Min(chunkSize, (unsigned int)(size - position - 8));
+		}
+
+		position += chunkSize + 8;
+	}
+
+	if (config == NULL || data == NULL)
+	{
+		free(buffer);
+		return FALSE;
+	}
+
+	// Frame size and superframe index as laid out by MakeConfig
+	const int frameBytes = (config[2] << 3 | config[3] >> 5) + 1;
+	const int superframeIndex = config[3] >> 3 & 3;
+
+	memcpy(stream->Config, config, CONFIG_DATA_SIZE);
+	stream->SuperframeCount = dataSize / (frameBytes << superframeIndex);
+	stream->Data = calloc(dataSize + BUFFER_PADDING, 1);
+	if (stream->Data) memcpy(stream->Data, data, dataSize);
+
+	free(buffer);
+	return stream->Data != NULL;
+}
+
+static At9Status DecodeStream(Atrac9Handle* handle, const Stream* stream, short* pcm)
+{
+	for (int s = 0; s < stream->SuperframeCount; s++)
+	{
+		const unsigned char* frame = stream->Data + s * handle->Config.SuperframeBytes;
+
+		for (int f = 0; f < handle->Config.FramesPerSuperframe; f++)
+		{
+			int bytesUsed;
+			ERROR_CHECK(Decode(handle, frame, (unsigned char*)pcm, &bytesUsed));
+			frame += bytesUsed;
+		}
+	}
+
+	return ERR_SUCCESS;
+}
+
+// The stream is decoded over and over on one handle. Every pass starts on a
+// superframe, so no frame depends on state the previous pass didn't leave.
+static void BenchStream(const char* name, const Stream* stream)
+{
+	static short pcm[MAX_FRAME_SAMPLES * MAX_CHANNEL_COUNT];
+	Atrac9Handle* handle = calloc(1, sizeof(Atrac9Handle));
+	ProfileStats profile;
+	int passes = 0;
+
+	if (handle == NULL || InitDecoder(handle, (unsigned char*)stream->Config, 16) != ERR_SUCCESS ||
+		DecodeStream(handle, stream, pcm) != ERR_SUCCESS || InitDecoder(handle, (unsigned char*)stream->Config, 16) != ERR_SUCCESS)
+	{
+		printf("%-24s decoding failed\n", name);
+		free(handle);
+		return;
+	}
+
+	const double start = Now();
+	double elapsed;
+	do
+	{
+		DecodeStream(handle, stream, pcm);
+		passes++;
+		elapsed = Now() - start;
+	} while (elapsed < BENCH_SECONDS);
+
+	const double frames = (double)passes * stream->SuperframeCount * handle->Config.FramesPerSuperframe;
+	const double samples = frames * handle->Config.FrameSamples * handle->Config.ChannelCount;
+	const int profiled = GetProfile(handle, &profile) == ERR_SUCCESS;
+
+	printf("%-24s %10.0f %9.2f", name, frames / elapsed, elapsed * 1e9 / samples);
+	for (int i = 0; i < ProfileStageCount; i++)
+	{
+		if (profiled && profile.Stages[i].Calls > 0) printf(" %9.0f", (double)profile.Stages[i].Cycles / profile.Stages[i].Calls);
+		else printf(" %9s", "-");
+	}
+	printf("\n");
+
+	free(handle);
+}
+
+// Decodes the stream on a double and a fixed-point handle side by side and
+// adds the differences between their PCM to the stream's line and the total
+static void CompareFixedPoint(const char* name, const Stream* stream, ErrorStats* total)
+{
+	Atrac9Handle* handle = calloc(1, sizeof(Atrac9Handle));
+	Atrac9Handle* fixedHandle = calloc(1, sizeof(Atrac9Handle));
+	ErrorStats stats;
+
+	memset(&stats, 0, sizeof(stats));
+	if (handle == NULL || fixedHandle == NULL || InitDecoder(handle, (unsigned char*)stream->Config, 16) != ERR_SUCCESS ||
+		InitDecoder(fixedHandle, (unsigned char*)stream->Config, 16) != ERR_SUCCESS || SetFixedPoint(fixedHandle, TRUE) != ERR_SUCCESS ||
+		CompareStreamPcm(handle, fixedHandle, stream, &stats) != ERR_SUCCESS)
+	{
+		printf("%-24s decoding failed\n", name);
+		free(handle);
+		free(fixedHandle);
+		return;
+	}
+
+	PrintErrorStats(name, &stats);
+
+	total->Samples += stats.Samples;
+	total->MaxError = Max(total->MaxError, stats.MaxError);
+	for (int i = 0; i < ERROR_BUCKETS; i++)
+	{
+		total->Histogram[i] += stats.Histogram[i];
+	}
+
+	free(handle);
+	free(fixedHandle);
+}
+
+static At9Status CompareStreamPcm(Atrac9Handle* handle, Atrac9Handle* fixedHandle, const Stream* stream, ErrorStats* stats)
+{
+	static short pcm[MAX_FRAME_SAMPLES * MAX_CHANNEL_COUNT];
+	static short fixedPcm[MAX_FRAME_SAMPLES * MAX_CHANNEL_COUNT];
+	const int sampleCount = handle->Config.FrameSamples * handle->Config.ChannelCount;
+
+	for (int s = 0; s < stream->SuperframeCount; s++)
+	{
+		const unsigned char* frame = stream->Data + s * handle->Config.SuperframeBytes;
+
+		for (int f = 0; f < handle->Config.FramesPerSuperframe; f++)
+		{
+			int bytesUsed, fixedBytesUsed;
+			ERROR_CHECK(Decode(handle, frame, (unsigned char*)pcm, &bytesUsed));
+			ERROR_CHECK(Decode(fixedHandle, frame, (unsigned char*)fixedPcm, &fixedBytesUsed));
+			frame += bytesUsed;
+
+			for (int i = 0; i < sampleCount; i++)
+			{
+				const int error = abs(pcm[i] - fixedPcm[i]);
+				stats->Histogram[Min(error, ERROR_BUCKETS - 1)]++;
+				stats->MaxError = Max(stats->MaxError, error);
+			}
+			stats->Samples += sampleCount;
+		}
+	}
+
+	return ERR_SUCCESS;
+}
+
+static void PrintErrorStats(const char* name, const ErrorStats* stats)
+{
+	const double same = stats->Samples > 0 ? 100.0 * stats->Histogram[0] / stats->Samples : 100.0;
+	printf("%-24s %10lld %9.3f %5d", name, stats->Samples, same, stats->MaxError);
+	for (int i = 0; i < ERROR_BUCKETS; i++)
+	{
+		printf(" %8lld", stats->Histogram[i]);
+	}
+	printf("\n");
+}
+
+static void BenchDct4(int bits)
+{
+	const int size = 1 << bits;
+	double input[MAX_FRAME_SAMPLES];
+	double output[MAX_FRAME_SAMPLES];
+	Mdct mdct;
+	long calls = 0;
+
+	memset(&mdct, 0, sizeof(mdct));
+	mdct.Bits = bits;
+	for (int i = 0; i < size; i++)
+	{
+		input[i] = Random(65536) - 32768;
+	}
+
+	const double start = Now();
+	double elapsed;
+	do
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			Kernels.Dct4(&mdct, input, size, output);
+		}
+		calls += 256;
+		elapsed = Now() - start;
+	} while (elapsed < MICRO_SECONDS);
+
+	printf("Dct4 %3d bins            %9.1f ns/call\n", size, elapsed * 1e9 / calls);
+}
+
+// Reads random bits with the allocation of a stereo frame that codes at
+// least 20 units. Low rates take the Huffman path and high rates don't.
+static void BenchReadSpectra(int sampleRateIndex)
+{
+	static short pcm[MAX_FRAME_SAMPLES * MAX_CHANNEL_COUNT];
+	unsigned char bits[4096 + BUFFER_PADDING];
+	Atrac9Handle* handle = calloc(1, sizeof(Atrac9Handle));
+	Stream stream;
+	long calls = 0;
+
+	if (handle == NULL || !GenerateStream(&stream, sampleRateIndex, 2, 0, SYNTHETIC_FRAMES))
+	{
+		free(handle);
+		return;
+	}
+
+	InitDecoder(handle, stream.Config, 16);
+	Channel* channel = &handle->Frame.Blocks[0].Channels[0];
+
+	for (int s = 0; s < stream.SuperframeCount && channel->CodedQuantUnits < 20; s++)
+	{
+		int bytesUsed;
+		if (Decode(handle, stream.Data + s * handle->Config.SuperframeBytes, (unsigned char*)pcm, &bytesUsed) != ERR_SUCCESS) break;
+	}
+
+	for (int i = 0; i < (int)sizeof(bits); i++)
+	{
+		bits[i] = (unsigned char)Random(256);
+	}
+
+	const double start = Now();
+	double elapsed;
+	do
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			BitReaderCxt br;
+			InitBitReaderCxt(&br, bits);
+			ReadSpectra(channel, &br);
+		}
+		calls += 256;
+		elapsed = Now() - start;
+	} while (elapsed < MICRO_SECONDS);
+
+	printf("ReadSpectra %6dHz     %9.1f ns/call, %d units\n", SampleRates[sampleRateIndex], elapsed * 1e9 / calls, channel->CodedQuantUnits);
+
+	free(stream.Data);
+	free(handle);
+}
+
+// Runs band extension on the first frame found that uses each mode
+static void BenchBandExtension(void)
+{
+	static short pcm[MAX_FRAME_SAMPLES * MAX_CHANNEL_COUNT];
+	Atrac9Handle* handle = calloc(1, sizeof(Atrac9Handle));
+	int found[5] = { 0 };
+	Stream stream;
+
+	if (handle == NULL || !GenerateStream(&stream, 7, 2, 0, SYNTHETIC_FRAMES * 8))
+	{
+		free(handle);
+		return;
+	}
+
+	InitDecoder(handle, stream.Config, 16);
+	Block* block = &handle->Frame.Blocks[0];
+	Channel* channel = &block->Channels[0];
+
+	for (int s = 0; s < stream.SuperframeCount; s++)
+	{
+		int bytesUsed;
+		if (Decode(handle, stream.Data + s * handle->Config.SuperframeBytes, (unsigned char*)pcm, &bytesUsed) != ERR_SUCCESS) break;
+		if (!block->BandExtensionEnabled || !block->HasExtensionData || found[channel->BexMode]) continue;
+
+		long calls = 0;
+		const double start = Now();
+		double elapsed;
+		do
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				ApplyBandExtension(channel);
+			}
+			calls += 256;
+			elapsed = Now() - start;
+		} while (elapsed < MICRO_SECONDS);
+
+		found[channel->BexMode] = TRUE;
+		printf("ApplyBandExtension mode %d %8.1f ns/call\n", channel->BexMode, elapsed * 1e9 / calls);
+	}
+
+	free(stream.Data);
+	free(handle);
+}
@@ -1,16 +1,24 @@
 #include "band_extension.h"
+#include "dispatch.h"
 #include "tables.h"
 #include "utility.h"
 #include <math.h>
 
 static void ApplyBandExtensionChannel(Channel* channel);
+static void ApplyBandExtensionChannelFixed(Channel* channel);
 
 static void ScaleBexQuantUnits(double* spectra, double* scales, int startUnit, int totalUnits);
 static void FillHighFrequencies(double* spectra, int groupABin, int groupBBin, int groupCBin, int totalBins);
 static void AddNoiseToSpectrum(Channel* channel, int index, int count);
+static void ScaleBexBinsFixed(int* spectra, int64_t scale, int start, int end);
+static void FillHighFrequenciesFixed(int* spectra, int groupABin, int groupBBin, int groupCBin, int totalBins);
+static void AddNoiseToSpectrumFixed(Channel* channel, int index, int count, int64_t scale);
+static int64_t ToFixedScale(double scale);
+static void InitChannelRng(Channel* channel);
 
 static void RngInit(RngCxt* rng, unsigned short seed);
 static unsigned short RngNext(RngCxt* rng);
+static void RngNextBlock(RngCxt* rng, unsigned short* values);
 
 static const double BexMode0Bands3[5][32];
 static const double BexMode0Bands4[5][16];
@@ -20,14 +28,18 @@ static const double BexMode3Initial[16];
 static const double BexMode3Rate[16];
 static const double BexMode4Multiplier[8];
 
-void ApplyBandExtension(Block* block)
+void ApplyBandExtension(Channel* channel)
 {
-	if (!block->BandExtensionEnabled || !block->HasExtensionData) return;
+	if (!channel->Block->BandExtensionEnabled || !channel->Block->HasExtensionData) return;
 
-	for (int i = 0; i < block->ChannelCount; i++)
-	{
-		ApplyBandExtensionChannel(&block->Channels[i]);
-	}
+	ApplyBandExtensionChannel(channel);
+}
+
+void ApplyBandExtensionFixed(Channel* channel)
+{
+	if (!channel->Block->BandExtensionEnabled || !channel->Block->HasExtensionData) return;
+
+	ApplyBandExtensionChannelFixed(channel);
 }
 
 static void ApplyBandExtensionChannel(Channel* channel)
@@ -52,6 +64,7 @@ static void ApplyBandExtensionChannel(Channel* channel)
 	const int totalBins = QuantUnitToCoeffIndex[totalUnits];
 
 	FillHighFrequencies(spectra, groupABin, groupBBin, groupCBin, totalBins);
+	channel->SpectraEnd = Max(channel->SpectraEnd, totalBins);
 
 	double groupAScale, groupBScale, groupCScale;
 	double rate, scale, mult;
@@ -101,15 +114,8 @@ static void ApplyBandExtensionChannel(Channel* channel)
 		groupAScale = BexMode2Scale[values[0]];
 		groupBScale = BexMode2Scale[values[1]];
 
-		for (int i = groupABin; i < groupBBin; i++)
-		{
-			spectra[i] *= groupAScale;
-		}
-
-		for (int i = groupBBin; i < groupCBin; i++)
-		{
-			spectra[i] *= groupBScale;
-		}
+		Kernels.ScaleSpectrum(spectra, groupAScale, groupABin, groupBBin);
+		Kernels.ScaleSpectrum(spectra, groupBScale, groupBBin, groupCBin);
 		return;
 	case 3:
 		rate = pow(2, BexMode3Rate[values[1]]);
@@ -126,35 +132,167 @@ static void ApplyBandExtensionChannel(Channel* channel)
 		groupBScale = 0.5011902 * mult;
 		groupCScale = 0.3548279 * mult;
 
-		for (int i = groupABin; i < groupBBin; i++)
+		Kernels.ScaleSpectrum(spectra, groupAScale, groupABin, groupBBin);
+		Kernels.ScaleSpectrum(spectra, groupBScale, groupBBin, groupCBin);
+		Kernels.ScaleSpectrum(spectra, groupCScale, groupCBin, totalBins);
+	}
+}
+
+static void ScaleBexQuantUnits(double* spectra, double* scales, int startUnit, int totalUnits)
+{
+	for (int i = startUnit; i < totalUnits; i++)
+	{
+		Kernels.ScaleSpectrum(spectra, scales[i - startUnit], QuantUnitToCoeffIndex[i], QuantUnitToCoeffIndex[i + 1]);
+	}
+}
+
+static void FillHighFrequencies(double* spectra, int groupABin, int groupBBin, int groupCBin, int totalBins)
+{
+	Kernels.MirrorSpectrum(spectra, groupABin, groupBBin);
+	Kernels.MirrorSpectrum(spectra, groupBBin, groupCBin);
+	Kernels.MirrorSpectrum(spectra, groupCBin, totalBins);
+}
+
+// The noise is made 4 values at a time so the conversions can run in
+// parallel. They keep the division, as multiplying by the reciprocal of
+// 65535 rounds differently for some values.
+static void AddNoiseToSpectrum(Channel* channel, int index, int count)
+{
+	double* spectra = channel->Spectra + index;
+	unsigned short noise[4];
+	int i = 0;
+
+	InitChannelRng(channel);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		RngNextBlock(&channel->Rng, noise);
+		for (int j = 0; j < 4; j++)
+		{
+			spectra[i + j] = noise[j] / 65535.0 * 2.0 - 1.0;
+		}
+	}
+
+	for (; i < count; i++)
+	{
+		spectra[i] = RngNext(&channel->Rng) / 65535.0 * 2.0 - 1.0;
+	}
+}
+
+static void InitChannelRng(Channel* channel)
+{
+	if (!channel->Rng.Initialized)
+	{
+		int* sf = channel->ScaleFactors;
+		const unsigned short seed = (unsigned short)(543 * (sf[8] + sf[12] + sf[15] + 1));
+		RngInit(&channel->Rng, seed);
+	}
+}
+
+// Mirrors ApplyBandExtensionChannel on FixedSpectra. The per-frame scales
+// are converted from the double tables, so only the per-bin math is integer.
+// Noise is scaled as it's generated, so it keeps its precision under the
+// large scales mode 0 and 1 can use.
+static void ApplyBandExtensionChannelFixed(Channel* channel)
+{
+	const int groupAUnit = channel->Block->QuantizationUnitCount;
+	int* scaleFactors = channel->ScaleFactors;
+	int* spectra = channel->FixedSpectra;
+	double scales[6];
+	int* values = channel->BexValues;
+
+	const BexGroup* bexInfo = &BexGroupInfo[channel->Block->QuantizationUnitCount - 13];
+	const int bandCount = bexInfo->BandCount;
+	const int groupBUnit = bexInfo->GroupBUnit;
+	const int groupCUnit = bexInfo->GroupCUnit;
+
+	const int totalUnits = Max(groupCUnit, 22);
+
+	const int groupABin = QuantUnitToCoeffIndex[groupAUnit];
+	const int groupBBin = QuantUnitToCoeffIndex[groupBUnit];
+	const int groupCBin = QuantUnitToCoeffIndex[groupCUnit];
+	const int totalBins = QuantUnitToCoeffIndex[totalUnits];
+
+	FillHighFrequenciesFixed(spectra, groupABin, groupBBin, groupCBin, totalBins);
+	channel->SpectraEnd = Max(channel->SpectraEnd, totalBins);
+
+	double mult;
+	int64_t scale, rate;
+
+	switch (channel->BexMode)
+	{
+	case 0:
+		switch (bandCount)
 		{
-			spectra[i] *= groupAScale;
+		case 3:
+			scales[0] = BexMode0Bands3[0][values[0]];
+			scales[1] = BexMode0Bands3[1][values[0]];
+			scales[2] = BexMode0Bands3[2][values[1]];
+			scales[3] = BexMode0Bands3[3][values[2]];
+			scales[4] = BexMode0Bands3[4][values[3]];
+			break;
+		case 4:
+			scales[0] = BexMode0Bands4[0][values[0]];
+			scales[1] = BexMode0Bands4[1][values[0]];
+			scales[2] = BexMode0Bands4[2][values[1]];
+			scales[3] = BexMode0Bands4[3][values[2]];
+			scales[4] = BexMode0Bands4[4][values[3]];
+			break;
+		case 5:
+			scales[0] = BexMode0Bands5[0][values[0]];
+			scales[1] = BexMode0Bands5[1][values[1]];
+			scales[2] = BexMode0Bands5[2][values[1]];
+			break;
 		}
 
-		for (int i = groupBBin; i < groupCBin; i++)
+		for (int i = groupAUnit; i < totalUnits - 1; i++)
 		{
-			spectra[i] *= groupBScale;
+			ScaleBexBinsFixed(spectra, ToFixedScale(scales[i - groupAUnit]), QuantUnitToCoeffIndex[i], QuantUnitToCoeffIndex[i + 1]);
 		}
 
-		for (int i = groupCBin; i < totalBins; i++)
+		AddNoiseToSpectrumFixed(channel, QuantUnitToCoeffIndex[totalUnits - 1],
+			QuantUnitToCoeffCount[totalUnits - 1], ToFixedScale(SpectrumScale[scaleFactors[groupAUnit]]));
+		break;
+	case 1:
+		for (int i = groupAUnit; i < totalUnits; i++)
 		{
-			spectra[i] *= groupCScale;
+			AddNoiseToSpectrumFixed(channel, QuantUnitToCoeffIndex[i], QuantUnitToCoeffCount[i],
+				ToFixedScale(SpectrumScale[scaleFactors[i]]));
 		}
+		break;
+	case 2:
+		ScaleBexBinsFixed(spectra, ToFixedScale(BexMode2Scale[values[0]]), groupABin, groupBBin);
+		ScaleBexBinsFixed(spectra, ToFixedScale(BexMode2Scale[values[1]]), groupBBin, groupCBin);
+		return;
+	case 3:
+		rate = ToFixedScale(pow(2, BexMode3Rate[values[1]]));
+		scale = ToFixedScale(BexMode3Initial[values[0]]);
+		for (int i = groupABin; i < totalBins; i++)
+		{
+			scale = Saturate32(RoundShift64(scale * rate, FIXED_SCALE_BITS));
+			spectra[i] = Saturate32(RoundShift64(spectra[i] * scale, FIXED_SCALE_BITS));
+		}
+		return;
+	case 4:
+		mult = BexMode4Multiplier[values[0]];
+		ScaleBexBinsFixed(spectra, ToFixedScale(0.7079468 * mult), groupABin, groupBBin);
+		ScaleBexBinsFixed(spectra, ToFixedScale(0.5011902 * mult), groupBBin, groupCBin);
+		ScaleBexBinsFixed(spectra, ToFixedScale(0.3548279 * mult), groupCBin, totalBins);
 	}
 }
 
-static void ScaleBexQuantUnits(double* spectra, double* scales, int startUnit, int totalUnits)
+// Scales are limited to 32 bits, so the products fit in 64
+static void ScaleBexBinsFixed(int* spectra, int64_t scale, int start, int end)
 {
-	for (int i = startUnit; i < totalUnits; i++)
+	scale = Saturate32(scale);
+
+	for (int i = start; i < end; i++)
 	{
-		for (int k = QuantUnitToCoeffIndex[i]; k < QuantUnitToCoeffIndex[i + 1]; k++)
-		{
-			spectra[k] *= scales[i - startUnit];
-		}
+		spectra[i] = Saturate32(RoundShift64(spectra[i] * scale, FIXED_SCALE_BITS));
 	}
 }
 
-static void FillHighFrequencies(double* spectra, int groupABin, int groupBBin, int groupCBin, int totalBins)
+static void FillHighFrequenciesFixed(int* spectra, int groupABin, int groupBBin, int groupCBin, int totalBins)
 {
 	for (int i = 0; i < groupBBin - groupABin; i++)
 	{
@@ -172,20 +310,23 @@ static void FillHighFrequencies(double* spectra, int groupABin, int groupBBin, i
 	}
 }
 
-static void AddNoiseToSpectrum(Channel* channel, int index, int count)
+// The noise is generated with 16 fractional bits. Scales come from
+// SpectrumScale and can reach 2^16, so they aren't limited to 32 bits.
+static void AddNoiseToSpectrumFixed(Channel* channel, int index, int count, int64_t scale)
 {
-	if (!channel->Rng.Initialized)
-	{
-		int* sf = channel->ScaleFactors;
-		const unsigned short seed = (unsigned short)(543 * (sf[8] + sf[12] + sf[15] + 1));
-		RngInit(&channel->Rng, seed);
-	}
+	InitChannelRng(channel);
 	for (int i = 0; i < count; i++)
 	{
-		channel->Spectra[i + index] = RngNext(&channel->Rng) / 65535.0 * 2.0 - 1.0;
+		const int64_t noise = ((int64_t)RngNext(&channel->Rng) * (2 << 16) + 32767) / 65535 - (1 << 16);
+		channel->FixedSpectra[i + index] = Saturate32(RoundShift64(noise * scale, 16 + FIXED_SCALE_BITS - FIXED_SAMPLE_BITS));
 	}
 }
 
+static int64_t ToFixedScale(double scale)
+{
+	return llround(ldexp(scale, FIXED_SCALE_BITS));
+}
+
 static void RngInit(RngCxt* rng, unsigned short seed)
 {
 	const int startValue = 0x4D93 * (seed ^ (seed >> 14));
@@ -207,6 +348,30 @@ static unsigned short RngNext(RngCxt* rng)
 	return rng->StateA;
 }
 
+// Four steps of RngNext at once. Each new A is h(D) ^ m(A), where h(x) is
+// t ^ (t >> 4) with t = x ^ (x << 5), and m(x) = x ^ (x >> 9). The h terms
+// only use the current state, so all four are found together with the
+// 16-bit states packed into one 64-bit word. Only the cheap m chain is
+// serial.
+static void RngNextBlock(RngCxt* rng, unsigned short* values)
+{
+	const uint64_t state = rng->StateD | (uint64_t)rng->StateC << 16 | (uint64_t)rng->StateB << 32 | (uint64_t)rng->StateA << 48;
+	const uint64_t t = state ^ ((state << 5) & 0xFFE0FFE0FFE0FFE0);
+	const uint64_t h = t ^ ((t >> 4) & 0x0FFF0FFF0FFF0FFF);
+
+	unsigned short a = rng->StateA;
+	for (int i = 0; i < 4; i++)
+	{
+		a = (unsigned short)(h >> (i * 16)) ^ a ^ (a >> 9);
+		values[i] = a;
+	}
+
+	rng->StateD = values[0];
+	rng->StateC = values[1];
+	rng->StateB = values[2];
+	rng->StateA = values[3];
+}
+
 const BexGroup BexGroupInfo[8] =
 {
 	{ 16, 21, 0 },
@@ -2,7 +2,8 @@
 
 #include "structures.h"
 
-void ApplyBandExtension(Block* block);
+void ApplyBandExtension(Channel* channel);
+void ApplyBandExtensionFixed(Channel* channel);
 
 extern const BexGroup BexGroupInfo[8];
 extern const char BexEncodedValueCounts[5][6];
@@ -4,9 +4,30 @@
 #include <string.h>
 
 static unsigned char GradientCurves[48][48];
+static unsigned char ScaledGradientCurves[31][31];
 
+// The gradient only changes when its parameters do, so it is kept from the
+// last frame unless one of them differs
 At9Status CreateGradient(Block* block)
 {
+	GradientKey* key = &block->GradientKey;
+	if (key->Valid &&
+		key->StartUnit == block->GradientStartUnit &&
+		key->StartValue == block->GradientStartValue &&
+		key->EndUnit == block->GradientEndUnit &&
+		key->EndValue == block->GradientEndValue &&
+		key->QuantizationUnitCount == block->QuantizationUnitCount)
+	{
+		return ERR_SUCCESS;
+	}
+
+	key->Valid = TRUE;
+	key->StartUnit = block->GradientStartUnit;
+	key->StartValue = block->GradientStartValue;
+	key->EndUnit = block->GradientEndUnit;
+	key->EndValue = block->GradientEndValue;
+	key->QuantizationUnitCount = block->QuantizationUnitCount;
+
 	int valueCount = block->GradientEndValue - block->GradientStartValue;
 	int unitCount = block->GradientEndUnit - block->GradientStartUnit;
 
@@ -25,26 +46,63 @@ At9Status CreateGradient(Block* block)
 	const unsigned char* curve = GradientCurves[unitCount - 1];
 	if (valueCount <= 0)
 	{
-		double scale = (-valueCount - 1) / 31.0;
+		const unsigned char* scaled = ScaledGradientCurves[-valueCount - 1];
 		int baseVal = block->GradientStartValue - 1;
 		for (int i = block->GradientStartUnit; i < block->GradientEndUnit; i++)
 		{
-			block->Gradient[i] = baseVal - (int)(curve[i - block->GradientStartUnit] * scale);
+			block->Gradient[i] = baseVal - scaled[curve[i - block->GradientStartUnit]];
 		}
 	}
 	else
 	{
-		double scale = (valueCount - 1) / 31.0;
+		const unsigned char* scaled = ScaledGradientCurves[valueCount - 1];
 		int baseVal = block->GradientStartValue + 1;
 		for (int i = block->GradientStartUnit; i < block->GradientEndUnit; i++)
 		{
-			block->Gradient[i] = baseVal + (int)(curve[i - block->GradientStartUnit] * scale);
+			block->Gradient[i] = baseVal + scaled[curve[i - block->GradientStartUnit]];
 		}
 	}
 
 	return ERR_SUCCESS;
 }
 
+// Returns FALSE if the mask, precisions and codebook set left from the last
+// frame are still valid, and otherwise records the new inputs. The scale
+// factors are compared in full rather than hashed, as a hash would have to
+// read all of them anyway and a collision would silently corrupt the frame.
+int AllocationChanged(Channel* channel)
+{
+	const Block* block = channel->Block;
+	AllocationKey* key = &channel->AllocationKey;
+	const int unitCount = block->QuantizationUnitCount;
+
+	if (key->Valid &&
+		key->GradientMode == block->GradientMode &&
+		key->GradientStartUnit == block->GradientStartUnit &&
+		key->GradientStartValue == block->GradientStartValue &&
+		key->GradientEndUnit == block->GradientEndUnit &&
+		key->GradientEndValue == block->GradientEndValue &&
+		key->GradientBoundary == block->GradientBoundary &&
+		key->QuantizationUnitCount == unitCount &&
+		key->CodedQuantUnits == channel->CodedQuantUnits &&
+		memcmp(key->ScaleFactors, channel->ScaleFactors, unitCount * sizeof(int)) == 0)
+	{
+		return FALSE;
+	}
+
+	key->Valid = TRUE;
+	key->GradientMode = block->GradientMode;
+	key->GradientStartUnit = block->GradientStartUnit;
+	key->GradientStartValue = block->GradientStartValue;
+	key->GradientEndUnit = block->GradientEndUnit;
+	key->GradientEndValue = block->GradientEndValue;
+	key->GradientBoundary = block->GradientBoundary;
+	key->QuantizationUnitCount = unitCount;
+	key->CodedQuantUnits = channel->CodedQuantUnits;
+	memcpy(key->ScaleFactors, channel->ScaleFactors, unitCount * sizeof(int));
+	return TRUE;
+}
+
 void CalculateMask(Channel* channel)
 {
 	memset(channel->PrecisionMask, 0, sizeof(channel->PrecisionMask));
@@ -62,61 +120,54 @@ void CalculateMask(Channel* channel)
 	}
 }
 
+// Done one unit at a time in a local, as the intermediate values can be
+// negative or above the stored range
 void CalculatePrecisions(Channel* channel)
 {
 	Block* block = channel->Block;
 
-	if (block->GradientMode != 0)
+	for (int i = 0; i < block->QuantizationUnitCount; i++)
 	{
-		for (int i = 0; i < block->QuantizationUnitCount; i++)
+		int precision;
+
+		if (block->GradientMode != 0)
 		{
-			channel->Precisions[i] = channel->ScaleFactors[i] + channel->PrecisionMask[i] - block->Gradient[i];
-			if (channel->Precisions[i] > 0)
+			precision = channel->ScaleFactors[i] + channel->PrecisionMask[i] - block->Gradient[i];
+			if (precision > 0)
 			{
 				switch (block->GradientMode)
 				{
 				case 1:
-					channel->Precisions[i] /= 2;
+					precision /= 2;
 					break;
 				case 2:
-					channel->Precisions[i] = 3 * channel->Precisions[i] / 8;
+					precision = 3 * precision / 8;
 					break;
 				case 3:
-					channel->Precisions[i] /= 4;
+					precision /= 4;
 					break;
 				}
 			}
 		}
-	}
-	else
-	{
-		for (int i = 0; i < block->QuantizationUnitCount; i++)
+		else
 		{
-			channel->Precisions[i] = channel->ScaleFactors[i] - block->Gradient[i];
+			precision = channel->ScaleFactors[i] - block->Gradient[i];
 		}
-	}
 
-	for (int i = 0; i < block->QuantizationUnitCount; i++)
-	{
-		if (channel->Precisions[i] < 1)
+		if (precision < 1)
 		{
-			channel->Precisions[i] = 1;
+			precision = 1;
 		}
-	}
 
-	for (int i = 0; i < block->GradientBoundary; i++)
-	{
-		channel->Precisions[i]++;
-	}
-
-	for (int i = 0; i < block->QuantizationUnitCount; i++)
-	{
-		channel->PrecisionsFine[i] = 0;
-		if (channel->Precisions[i] > 15)
+		if (i < block->GradientBoundary)
 		{
-			channel->PrecisionsFine[i] = channel->Precisions[i] - 15;
-			channel->Precisions[i] = 15;
+			precision++;
 		}
+
+		// Fine precisions are capped at 15, as in FFmpeg's decoder, so the
+		// fine values fit in 16 bits and the step size tables cover them
+		channel->PrecisionsFine[i] = precision > 15 ? Min(precision, 30) - 15 : 0;
+		channel->Precisions[i] = Min(precision, 15);
 	}
 }
 
@@ -138,4 +189,15 @@ void GenerateGradientCurves()
 			GradientCurves[length - 1][i] = BaseCurve[i * baseLength / length];
 		}
 	}
+
+	// Every curve value scaled by every possible value range, computed the
+	// same way CreateGradient used to so the truncation matches
+	for (int range = 0; range < 31; range++)
+	{
+		const double scale = range / 31.0;
+		for (int value = 0; value < 31; value++)
+		{
+			ScaledGradientCurves[range][value] = (int)(value * scale);
+		}
+	}
 }
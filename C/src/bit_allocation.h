@@ -3,6 +3,7 @@
 #include "unpack.h"
 
 At9Status CreateGradient(Block* block);
+int AllocationChanged(Channel* channel);
 void CalculateMask(Channel* channel);
 void CalculatePrecisions(Channel* channel);
 void GenerateGradientCurves();
@@ -1,7 +1,9 @@
 #include "bit_reader.h"
 #include "utility.h"
+#include <stddef.h>
+#include <stdint.h>
 
-static int PeekIntFallback(BitReaderCxt* br, int bitCount);
+static void ReadFields(BitReaderCxt* br, int bits, int count, int* values, short* shortValues);
 
 void InitBitReaderCxt(BitReaderCxt* br, const void * buffer)
 {
@@ -9,62 +11,16 @@ void InitBitReaderCxt(BitReaderCxt* br, const void * buffer)
 	br->Position = 0;
 }
 
-int ReadInt(BitReaderCxt* br, const int bits)
+// Reads count consecutive unsigned fields of the same width, up to 32 bits each
+void ReadInts(BitReaderCxt* br, const int bits, const int count, int* values)
 {
-	const int value = PeekInt(br, bits);
-	br->Position += bits;
-	return value;
+	ReadFields(br, bits, count, values, NULL);
 }
 
-int ReadSignedInt(BitReaderCxt* br, const int bits)
+// Reads count consecutive signed fields of the same width, up to 16 bits each
+void ReadSignedShorts(BitReaderCxt* br, const int bits, const int count, short* values)
 {
-	const int value = PeekInt(br, bits);
-	br->Position += bits;
-	return SignExtend32(value, bits);
-}
-
-int ReadOffsetBinary(BitReaderCxt* br, const int bits)
-{
-	const int offset = 1 << (bits - 1);
-	const int value = PeekInt(br, bits) - offset;
-	br->Position += bits;
-	return value;
-}
-
-int PeekInt(BitReaderCxt* br, const int bits)
-{
-	const int byteIndex = br->Position / 8;
-	const int bitIndex = br->Position % 8;
-	const unsigned char* buffer = br->Buffer;
-
-	if (bits <= 9)
-	{
-		int value = buffer[byteIndex] << 8 | buffer[byteIndex + 1];
-		value &= 0xFFFF >> bitIndex;
-		value >>= 16 - bits - bitIndex;
-		return value;
-	}
-
-	if (bits <= 17)
-	{
-		int value = buffer[byteIndex] << 16 | buffer[byteIndex + 1] << 8 | buffer[byteIndex + 2];
-		value &= 0xFFFFFF >> bitIndex;
-		value >>= 24 - bits - bitIndex;
-		return value;
-	}
-
-	if (bits <= 25)
-	{
-		int value = buffer[byteIndex] << 24
-			| buffer[byteIndex + 1] << 16
-			| buffer[byteIndex + 2] << 8
-			| buffer[byteIndex + 3];
-
-		value &= (int)(0xFFFFFFFF >> bitIndex);
-		value >>= 32 - bits - bitIndex;
-		return value;
-	}
-	return PeekIntFallback(br, bits);
+	ReadFields(br, bits, count, NULL, values);
 }
 
 void AlignPosition(BitReaderCxt* br, const unsigned int multiple)
@@ -78,7 +34,7 @@ void AlignPosition(BitReaderCxt* br, const unsigned int multiple)
 	br->Position = position + multiple - position % multiple;
 }
 
-static int PeekIntFallback(BitReaderCxt* br, int bitCount)
+int PeekIntFallback(BitReaderCxt* br, int bitCount)
 {
 	int value = 0;
 	int byteIndex = br->Position / 8;
@@ -107,4 +63,43 @@ static int PeekIntFallback(BitReaderCxt* br, int bitCount)
 		bitCount -= bitsToRead;
 	}
 	return value;
-}
\ No newline at end of file
+}
+
+// The fields are taken from a 64-bit cache that is refilled several bytes
+// at a time. It never loads past the last byte holding one of the fields.
+static void ReadFields(BitReaderCxt* br, int bits, int count, int* values, short* shortValues)
+{
+	if (count <= 0) return;
+
+	const unsigned char* byte = br->Buffer + br->Position / 8;
+	const unsigned char* end = br->Buffer + (br->Position + bits * count + 7) / 8;
+	const uint64_t mask = ((uint64_t)1 << bits) - 1;
+	const int64_t sign = shortValues ? (int64_t)1 << (bits - 1) : 0;
+	uint64_t cache = *byte++;
+	int cacheBits = 8 - br->Position % 8;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (cacheBits < bits)
+		{
+			while (cacheBits <= 56 && byte < end)
+			{
+				cache = cache << 8 | *byte++;
+				cacheBits += 8;
+			}
+		}
+
+		cacheBits -= bits;
+		const int64_t value = (cache >> cacheBits) & mask;
+		if (shortValues)
+		{
+			shortValues[i] = (short)((value ^ sign) - sign);
+		}
+		else
+		{
+			values[i] = (int)value;
+		}
+	}
+
+	br->Position += bits * count;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "utility.h"
+
 typedef struct {
 	const unsigned char * Buffer;
 	int Position;
@@ -8,8 +10,66 @@ typedef struct {
 // Make MSVC compiler happy. Leave const in for value parameters
 
 void InitBitReaderCxt(BitReaderCxt* br, const void * buffer);
-int PeekInt(BitReaderCxt* br, const int bits);
-int ReadInt(BitReaderCxt* br, const int bits);
-int ReadSignedInt(BitReaderCxt* br, const int bits);
-int ReadOffsetBinary(BitReaderCxt* br, const int bits);
+int PeekIntFallback(BitReaderCxt* br, int bitCount);
+void ReadInts(BitReaderCxt* br, const int bits, const int count, int* values);
+void ReadSignedShorts(BitReaderCxt* br, const int bits, const int count, short* values);
 void AlignPosition(BitReaderCxt* br, const unsigned int multiple);
+
+// Field reads happen for every value in a frame, so they are inlined
+static inline int PeekInt(BitReaderCxt* br, const int bits)
+{
+	const int byteIndex = br->Position / 8;
+	const int bitIndex = br->Position % 8;
+	const unsigned char* buffer = br->Buffer;
+
+	if (bits <= 9)
+	{
+		int value = buffer[byteIndex] << 8 | buffer[byteIndex + 1];
+		value &= 0xFFFF >> bitIndex;
+		value >>= 16 - bits - bitIndex;
+		return value;
+	}
+
+	if (bits <= 17)
+	{
+		int value = buffer[byteIndex] << 16 | buffer[byteIndex + 1] << 8 | buffer[byteIndex + 2];
+		value &= 0xFFFFFF >> bitIndex;
+		value >>= 24 - bits - bitIndex;
+		return value;
+	}
+
+	if (bits <= 25)
+	{
+		int value = buffer[byteIndex] << 24
+			| buffer[byteIndex + 1] << 16
+			| buffer[byteIndex + 2] << 8
+			| buffer[byteIndex + 3];
+
+		value &= (int)(0xFFFFFFFF >> bitIndex);
+		value >>= 32 - bits - bitIndex;
+		return value;
+	}
+	return PeekIntFallback(br, bits);
+}
+
+static inline int ReadInt(BitReaderCxt* br, const int bits)
+{
+	const int value = PeekInt(br, bits);
+	br->Position += bits;
+	return value;
+}
+
+static inline int ReadSignedInt(BitReaderCxt* br, const int bits)
+{
+	const int value = PeekInt(br, bits);
+	br->Position += bits;
+	return SignExtend32(value, bits);
+}
+
+static inline int ReadOffsetBinary(BitReaderCxt* br, const int bits)
+{
+	const int offset = 1 << (bits - 1);
+	const int value = PeekInt(br, bits) - offset;
+	br->Position += bits;
+	return value;
+}
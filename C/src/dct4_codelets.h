@@ -0,0 +1,3465 @@
+// Generated by tools/gen_dct4_codelets.c from the tables built by InitMdctTables.
+// Don't edit this file; run "make codelets" instead.
+#pragma once
+
+static void Dct4Stages64(const double* block, double* output)
+{
+	double a, b;
+	double v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15;
+	double v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31;
+	double v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44, v45, v46, v47;
+	double v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59, v60, v61, v62, v63;
+
+	v0 = block[0];
+	v1 = block[1];
+	v2 = block[2];
+	v3 = block[3];
+	v4 = block[4];
+	v5 = block[5];
+	v6 = block[6];
+	v7 = block[7];
+	v8 = block[8];
+	v9 = block[9];
+	v10 = block[10];
+	v11 = block[11];
+	v12 = block[12];
+	v13 = block[13];
+	v14 = block[14];
+	v15 = block[15];
+	v16 = block[16];
+	v17 = block[17];
+	v18 = block[18];
+	v19 = block[19];
+	v20 = block[20];
+	v21 = block[21];
+	v22 = block[22];
+	v23 = block[23];
+	v24 = block[24];
+	v25 = block[25];
+	v26 = block[26];
+	v27 = block[27];
+	v28 = block[28];
+	v29 = block[29];
+	v30 = block[30];
+	v31 = block[31];
+	v32 = block[32];
+	v33 = block[33];
+	v34 = block[34];
+	v35 = block[35];
+	v36 = block[36];
+	v37 = block[37];
+	v38 = block[38];
+	v39 = block[39];
+	v40 = block[40];
+	v41 = block[41];
+	v42 = block[42];
+	v43 = block[43];
+	v44 = block[44];
+	v45 = block[45];
+	v46 = block[46];
+	v47 = block[47];
+	v48 = block[48];
+	v49 = block[49];
+	v50 = block[50];
+	v51 = block[51];
+	v52 = block[52];
+	v53 = block[53];
+	v54 = block[54];
+	v55 = block[55];
+	v56 = block[56];
+	v57 = block[57];
+	v58 = block[58];
+	v59 = block[59];
+	v60 = block[60];
+	v61 = block[61];
+	v62 = block[62];
+	v63 = block[63];
+	a = v0 - v32;
+	b = v1 - v33;
+	v0 += v32;
+	v1 += v33;
+	v32 = a * 0x1.ff621e3796d7ep-1 + b * 0x1.91f65f10dd814p-5;
+	v33 = a * 0x1.91f65f10dd814p-5 - b * 0x1.ff621e3796d7ep-1;
+	a = v2 - v34;
+	b = v3 - v35;
+	v2 += v34;
+	v3 += v35;
+	v34 = a * 0x1.f0a7efb9230d7p-1 + b * 0x1.f19f97b215f1ap-3;
+	v35 = a * 0x1.f19f97b215f1ap-3 - b * 0x1.f0a7efb9230d7p-1;
+	a = v4 - v36;
+	b = v5 - v37;
+	v4 += v36;
+	v5 += v37;
+	v36 = a * 0x1.ced7af43cc773p-1 + b * 0x1.b5d1009e15ccp-2;
+	v37 = a * 0x1.b5d1009e15ccp-2 - b * 0x1.ced7af43cc773p-1;
+	a = v6 - v38;
+	b = v7 - v39;
+	v6 += v38;
+	v7 += v39;
+	v38 = a * 0x1.9b3e047f38741p-1 + b * 0x1.30ff7fce17035p-1;
+	v39 = a * 0x1.30ff7fce17035p-1 - b * 0x1.9b3e047f38741p-1;
+	a = v8 - v40;
+	b = v9 - v41;
+	v8 += v40;
+	v9 += v41;
+	v40 = a * 0x1.57d69348cec9fp-1 + b * 0x1.7b5df226aafafp-1;
+	v41 = a * 0x1.7b5df226aafafp-1 - b * 0x1.57d69348cec9fp-1;
+	a = v10 - v42;
+	b = v11 - v43;
+	v10 += v42;
+	v11 += v43;
+	v42 = a * 0x1.073879922ffedp-1 + b * 0x1.b728345196e3ep-1;
+	v43 = a * 0x1.b728345196e3ep-1 - b * 0x1.073879922ffedp-1;
+	a = v12 - v44;
+	b = v13 - v45;
+	v12 += v44;
+	v13 += v45;
+	v44 = a * 0x1.58f9a75ab1fddp-2 + b * 0x1.e212104f686e5p-1;
+	v45 = a * 0x1.e212104f686e5p-1 - b * 0x1.58f9a75ab1fddp-2;
+	a = v14 - v46;
+	b = v15 - v47;
+	v14 += v46;
+	v15 += v47;
+	v46 = a * 0x1.2c8106e8e613ap-3 + b * 0x1.fa7557f08a517p-1;
+	v47 = a * 0x1.fa7557f08a517p-1 - b * 0x1.2c8106e8e613ap-3;
+	a = v16 - v48;
+	b = v17 - v49;
+	v16 += v48;
+	v17 += v49;
+	v48 = a * -0x1.91f65f10dd813p-5 + b * 0x1.ff621e3796d7ep-1;
+	v49 = a * 0x1.ff621e3796d7ep-1 - b * -0x1.91f65f10dd813p-5;
+	a = v18 - v50;
+	b = v19 - v51;
+	v18 += v50;
+	v19 += v51;
+	v50 = a * -0x1.f19f97b215f1ap-3 + b * 0x1.f0a7efb9230d7p-1;
+	v51 = a * 0x1.f0a7efb9230d7p-1 - b * -0x1.f19f97b215f1ap-3;
+	a = v20 - v52;
+	b = v21 - v53;
+	v20 += v52;
+	v21 += v53;
+	v52 = a * -0x1.b5d1009e15cbcp-2 + b * 0x1.ced7af43cc774p-1;
+	v53 = a * 0x1.ced7af43cc774p-1 - b * -0x1.b5d1009e15cbcp-2;
+	a = v22 - v54;
+	b = v23 - v55;
+	v22 += v54;
+	v23 += v55;
+	v54 = a * -0x1.30ff7fce17035p-1 + b * 0x1.9b3e047f38741p-1;
+	v55 = a * 0x1.9b3e047f38741p-1 - b * -0x1.30ff7fce17035p-1;
+	a = v24 - v56;
+	b = v25 - v57;
+	v24 += v56;
+	v25 += v57;
+	v56 = a * -0x1.7b5df226aafadp-1 + b * 0x1.57d69348ceca1p-1;
+	v57 = a * 0x1.57d69348ceca1p-1 - b * -0x1.7b5df226aafadp-1;
+	a = v26 - v58;
+	b = v27 - v59;
+	v26 += v58;
+	v27 += v59;
+	v58 = a * -0x1.b728345196e3dp-1 + b * 0x1.073879922ffeep-1;
+	v59 = a * 0x1.073879922ffeep-1 - b * -0x1.b728345196e3dp-1;
+	a = v28 - v60;
+	b = v29 - v61;
+	v28 += v60;
+	v29 += v61;
+	v60 = a * -0x1.e212104f686e4p-1 + b * 0x1.58f9a75ab1fe2p-2;
+	v61 = a * 0x1.58f9a75ab1fe2p-2 - b * -0x1.e212104f686e4p-1;
+	a = v30 - v62;
+	b = v31 - v63;
+	v30 += v62;
+	v31 += v63;
+	v62 = a * -0x1.fa7557f08a517p-1 + b * 0x1.2c8106e8e613cp-3;
+	v63 = a * 0x1.2c8106e8e613cp-3 - b * -0x1.fa7557f08a517p-1;
+	a = v0 - v16;
+	b = v1 - v17;
+	v0 += v16;
+	v1 += v17;
+	v16 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v17 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v2 - v18;
+	b = v3 - v19;
+	v2 += v18;
+	v3 += v19;
+	v18 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v19 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v4 - v20;
+	b = v5 - v21;
+	v4 += v20;
+	v5 += v21;
+	v20 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v21 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v6 - v22;
+	b = v7 - v23;
+	v6 += v22;
+	v7 += v23;
+	v22 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v23 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v8 - v24;
+	b = v9 - v25;
+	v8 += v24;
+	v9 += v25;
+	v24 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v25 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v10 - v26;
+	b = v11 - v27;
+	v10 += v26;
+	v11 += v27;
+	v26 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v27 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v12 - v28;
+	b = v13 - v29;
+	v12 += v28;
+	v13 += v29;
+	v28 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v29 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v14 - v30;
+	b = v15 - v31;
+	v14 += v30;
+	v15 += v31;
+	v30 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v31 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v32 - v48;
+	b = v33 - v49;
+	v32 += v48;
+	v33 += v49;
+	v48 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v49 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v34 - v50;
+	b = v35 - v51;
+	v34 += v50;
+	v35 += v51;
+	v50 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v51 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v36 - v52;
+	b = v37 - v53;
+	v36 += v52;
+	v37 += v53;
+	v52 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v53 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v38 - v54;
+	b = v39 - v55;
+	v38 += v54;
+	v39 += v55;
+	v54 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v55 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v40 - v56;
+	b = v41 - v57;
+	v40 += v56;
+	v41 += v57;
+	v56 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v57 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v42 - v58;
+	b = v43 - v59;
+	v42 += v58;
+	v43 += v59;
+	v58 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v59 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v44 - v60;
+	b = v45 - v61;
+	v44 += v60;
+	v45 += v61;
+	v60 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v61 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v46 - v62;
+	b = v47 - v63;
+	v46 += v62;
+	v47 += v63;
+	v62 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v63 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v0 - v8;
+	b = v1 - v9;
+	v0 += v8;
+	v1 += v9;
+	v8 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v9 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v2 - v10;
+	b = v3 - v11;
+	v2 += v10;
+	v3 += v11;
+	v10 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v11 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v4 - v12;
+	b = v5 - v13;
+	v4 += v12;
+	v5 += v13;
+	v12 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v13 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v6 - v14;
+	b = v7 - v15;
+	v6 += v14;
+	v7 += v15;
+	v14 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v15 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v16 - v24;
+	b = v17 - v25;
+	v16 += v24;
+	v17 += v25;
+	v24 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v25 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v18 - v26;
+	b = v19 - v27;
+	v18 += v26;
+	v19 += v27;
+	v26 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v27 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v20 - v28;
+	b = v21 - v29;
+	v20 += v28;
+	v21 += v29;
+	v28 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v29 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v22 - v30;
+	b = v23 - v31;
+	v22 += v30;
+	v23 += v31;
+	v30 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v31 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v32 - v40;
+	b = v33 - v41;
+	v32 += v40;
+	v33 += v41;
+	v40 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v41 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v34 - v42;
+	b = v35 - v43;
+	v34 += v42;
+	v35 += v43;
+	v42 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v43 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v36 - v44;
+	b = v37 - v45;
+	v36 += v44;
+	v37 += v45;
+	v44 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v45 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v38 - v46;
+	b = v39 - v47;
+	v38 += v46;
+	v39 += v47;
+	v46 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v47 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v48 - v56;
+	b = v49 - v57;
+	v48 += v56;
+	v49 += v57;
+	v56 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v57 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v50 - v58;
+	b = v51 - v59;
+	v50 += v58;
+	v51 += v59;
+	v58 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v59 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v52 - v60;
+	b = v53 - v61;
+	v52 += v60;
+	v53 += v61;
+	v60 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v61 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v54 - v62;
+	b = v55 - v63;
+	v54 += v62;
+	v55 += v63;
+	v62 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v63 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v0 - v4;
+	b = v1 - v5;
+	v0 += v4;
+	v1 += v5;
+	v4 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v5 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v2 - v6;
+	b = v3 - v7;
+	v2 += v6;
+	v3 += v7;
+	v6 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v7 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v0 - v2;
+	b = v1 - v3;
+	v0 += v2;
+	v1 += v3;
+	v2 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v3 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v4 - v6;
+	b = v5 - v7;
+	v4 += v6;
+	v5 += v7;
+	v6 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v7 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[0] = v0;
+	output[63] = v1;
+	output[31] = v2;
+	output[32] = v3;
+	output[15] = v4;
+	output[48] = v5;
+	output[16] = v6;
+	output[47] = v7;
+	a = v8 - v12;
+	b = v9 - v13;
+	v8 += v12;
+	v9 += v13;
+	v12 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v13 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v10 - v14;
+	b = v11 - v15;
+	v10 += v14;
+	v11 += v15;
+	v14 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v15 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v8 - v10;
+	b = v9 - v11;
+	v8 += v10;
+	v9 += v11;
+	v10 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v11 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v12 - v14;
+	b = v13 - v15;
+	v12 += v14;
+	v13 += v15;
+	v14 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v15 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[7] = v8;
+	output[56] = v9;
+	output[24] = v10;
+	output[39] = v11;
+	output[8] = v12;
+	output[55] = v13;
+	output[23] = v14;
+	output[40] = v15;
+	a = v16 - v20;
+	b = v17 - v21;
+	v16 += v20;
+	v17 += v21;
+	v20 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v21 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v18 - v22;
+	b = v19 - v23;
+	v18 += v22;
+	v19 += v23;
+	v22 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v23 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v16 - v18;
+	b = v17 - v19;
+	v16 += v18;
+	v17 += v19;
+	v18 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v19 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v20 - v22;
+	b = v21 - v23;
+	v20 += v22;
+	v21 += v23;
+	v22 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v23 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[3] = v16;
+	output[60] = v17;
+	output[28] = v18;
+	output[35] = v19;
+	output[12] = v20;
+	output[51] = v21;
+	output[19] = v22;
+	output[44] = v23;
+	a = v24 - v28;
+	b = v25 - v29;
+	v24 += v28;
+	v25 += v29;
+	v28 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v29 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v26 - v30;
+	b = v27 - v31;
+	v26 += v30;
+	v27 += v31;
+	v30 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v31 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v24 - v26;
+	b = v25 - v27;
+	v24 += v26;
+	v25 += v27;
+	v26 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v27 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v28 - v30;
+	b = v29 - v31;
+	v28 += v30;
+	v29 += v31;
+	v30 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v31 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[4] = v24;
+	output[59] = v25;
+	output[27] = v26;
+	output[36] = v27;
+	output[11] = v28;
+	output[52] = v29;
+	output[20] = v30;
+	output[43] = v31;
+	a = v32 - v36;
+	b = v33 - v37;
+	v32 += v36;
+	v33 += v37;
+	v36 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v37 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v34 - v38;
+	b = v35 - v39;
+	v34 += v38;
+	v35 += v39;
+	v38 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v39 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v32 - v34;
+	b = v33 - v35;
+	v32 += v34;
+	v33 += v35;
+	v34 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v35 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v36 - v38;
+	b = v37 - v39;
+	v36 += v38;
+	v37 += v39;
+	v38 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v39 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[1] = v32;
+	output[62] = v33;
+	output[30] = v34;
+	output[33] = v35;
+	output[14] = v36;
+	output[49] = v37;
+	output[17] = v38;
+	output[46] = v39;
+	a = v40 - v44;
+	b = v41 - v45;
+	v40 += v44;
+	v41 += v45;
+	v44 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v45 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v42 - v46;
+	b = v43 - v47;
+	v42 += v46;
+	v43 += v47;
+	v46 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v47 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v40 - v42;
+	b = v41 - v43;
+	v40 += v42;
+	v41 += v43;
+	v42 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v43 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v44 - v46;
+	b = v45 - v47;
+	v44 += v46;
+	v45 += v47;
+	v46 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v47 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[6] = v40;
+	output[57] = v41;
+	output[25] = v42;
+	output[38] = v43;
+	output[9] = v44;
+	output[54] = v45;
+	output[22] = v46;
+	output[41] = v47;
+	a = v48 - v52;
+	b = v49 - v53;
+	v48 += v52;
+	v49 += v53;
+	v52 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v53 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v50 - v54;
+	b = v51 - v55;
+	v50 += v54;
+	v51 += v55;
+	v54 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v55 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v48 - v50;
+	b = v49 - v51;
+	v48 += v50;
+	v49 += v51;
+	v50 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v51 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v52 - v54;
+	b = v53 - v55;
+	v52 += v54;
+	v53 += v55;
+	v54 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v55 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[2] = v48;
+	output[61] = v49;
+	output[29] = v50;
+	output[34] = v51;
+	output[13] = v52;
+	output[50] = v53;
+	output[18] = v54;
+	output[45] = v55;
+	a = v56 - v60;
+	b = v57 - v61;
+	v56 += v60;
+	v57 += v61;
+	v60 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v61 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v58 - v62;
+	b = v59 - v63;
+	v58 += v62;
+	v59 += v63;
+	v62 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v63 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v56 - v58;
+	b = v57 - v59;
+	v56 += v58;
+	v57 += v59;
+	v58 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v59 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v60 - v62;
+	b = v61 - v63;
+	v60 += v62;
+	v61 += v63;
+	v62 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v63 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[5] = v56;
+	output[58] = v57;
+	output[26] = v58;
+	output[37] = v59;
+	output[10] = v60;
+	output[53] = v61;
+	output[21] = v62;
+	output[42] = v63;
+}
+
+static void Dct4Stages128(const double* block, double* output)
+{
+	double a, b;
+	double v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15;
+	double v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31;
+	double v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44, v45, v46, v47;
+	double v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59, v60, v61, v62, v63;
+	double v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74, v75, v76, v77, v78, v79;
+	double v80, v81, v82, v83, v84, v85, v86, v87, v88, v89, v90, v91, v92, v93, v94, v95;
+	double v96, v97, v98, v99, v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110, v111;
+	double v112, v113, v114, v115, v116, v117, v118, v119, v120, v121, v122, v123, v124, v125, v126, v127;
+
+	v0 = block[0];
+	v1 = block[1];
+	v2 = block[2];
+	v3 = block[3];
+	v4 = block[4];
+	v5 = block[5];
+	v6 = block[6];
+	v7 = block[7];
+	v8 = block[8];
+	v9 = block[9];
+	v10 = block[10];
+	v11 = block[11];
+	v12 = block[12];
+	v13 = block[13];
+	v14 = block[14];
+	v15 = block[15];
+	v16 = block[16];
+	v17 = block[17];
+	v18 = block[18];
+	v19 = block[19];
+	v20 = block[20];
+	v21 = block[21];
+	v22 = block[22];
+	v23 = block[23];
+	v24 = block[24];
+	v25 = block[25];
+	v26 = block[26];
+	v27 = block[27];
+	v28 = block[28];
+	v29 = block[29];
+	v30 = block[30];
+	v31 = block[31];
+	v32 = block[32];
+	v33 = block[33];
+	v34 = block[34];
+	v35 = block[35];
+	v36 = block[36];
+	v37 = block[37];
+	v38 = block[38];
+	v39 = block[39];
+	v40 = block[40];
+	v41 = block[41];
+	v42 = block[42];
+	v43 = block[43];
+	v44 = block[44];
+	v45 = block[45];
+	v46 = block[46];
+	v47 = block[47];
+	v48 = block[48];
+	v49 = block[49];
+	v50 = block[50];
+	v51 = block[51];
+	v52 = block[52];
+	v53 = block[53];
+	v54 = block[54];
+	v55 = block[55];
+	v56 = block[56];
+	v57 = block[57];
+	v58 = block[58];
+	v59 = block[59];
+	v60 = block[60];
+	v61 = block[61];
+	v62 = block[62];
+	v63 = block[63];
+	v64 = block[64];
+	v65 = block[65];
+	v66 = block[66];
+	v67 = block[67];
+	v68 = block[68];
+	v69 = block[69];
+	v70 = block[70];
+	v71 = block[71];
+	v72 = block[72];
+	v73 = block[73];
+	v74 = block[74];
+	v75 = block[75];
+	v76 = block[76];
+	v77 = block[77];
+	v78 = block[78];
+	v79 = block[79];
+	v80 = block[80];
+	v81 = block[81];
+	v82 = block[82];
+	v83 = block[83];
+	v84 = block[84];
+	v85 = block[85];
+	v86 = block[86];
+	v87 = block[87];
+	v88 = block[88];
+	v89 = block[89];
+	v90 = block[90];
+	v91 = block[91];
+	v92 = block[92];
+	v93 = block[93];
+	v94 = block[94];
+	v95 = block[95];
+	v96 = block[96];
+	v97 = block[97];
+	v98 = block[98];
+	v99 = block[99];
+	v100 = block[100];
+	v101 = block[101];
+	v102 = block[102];
+	v103 = block[103];
+	v104 = block[104];
+	v105 = block[105];
+	v106 = block[106];
+	v107 = block[107];
+	v108 = block[108];
+	v109 = block[109];
+	v110 = block[110];
+	v111 = block[111];
+	v112 = block[112];
+	v113 = block[113];
+	v114 = block[114];
+	v115 = block[115];
+	v116 = block[116];
+	v117 = block[117];
+	v118 = block[118];
+	v119 = block[119];
+	v120 = block[120];
+	v121 = block[121];
+	v122 = block[122];
+	v123 = block[123];
+	v124 = block[124];
+	v125 = block[125];
+	v126 = block[126];
+	v127 = block[127];
+	a = v0 - v64;
+	b = v1 - v65;
+	v0 += v64;
+	v1 += v65;
+	v64 = a * 0x1.ffd886084cd0dp-1 + b * 0x1.92155f7a3667ep-6;
+	v65 = a * 0x1.92155f7a3667ep-6 - b * 0x1.ffd886084cd0dp-1;
+	a = v2 - v66;
+	b = v3 - v67;
+	v2 += v66;
+	v3 += v67;
+	v66 = a * 0x1.fc26470e19fd3p-1 + b * 0x1.f564e56a9730ep-4;
+	v67 = a * 0x1.f564e56a9730ep-4 - b * 0x1.fc26470e19fd3p-1;
+	a = v4 - v68;
+	b = v5 - v69;
+	v4 += v68;
+	v5 += v69;
+	v68 = a * 0x1.f38f3ac64e589p-1 + b * 0x1.c0b826a7e4f63p-3;
+	v69 = a * 0x1.c0b826a7e4f63p-3 - b * 0x1.f38f3ac64e589p-1;
+	a = v6 - v70;
+	b = v7 - v71;
+	v6 += v70;
+	v7 += v71;
+	v70 = a * 0x1.e6288ec48e112p-1 + b * 0x1.4135c94176602p-2;
+	v71 = a * 0x1.4135c94176602p-2 - b * 0x1.e6288ec48e112p-1;
+	a = v8 - v72;
+	b = v9 - v73;
+	v8 += v72;
+	v9 += v73;
+	v72 = a * 0x1.d4134d14dc93ap-1 + b * 0x1.9ef7943a8ed8ap-2;
+	v73 = a * 0x1.9ef7943a8ed8ap-2 - b * 0x1.d4134d14dc93ap-1;
+	a = v10 - v74;
+	b = v11 - v75;
+	v10 += v74;
+	v11 += v75;
+	v74 = a * 0x1.bd7c0ac6f952ap-1 + b * 0x1.f8ba4dbf89abap-2;
+	v75 = a * 0x1.f8ba4dbf89abap-2 - b * 0x1.bd7c0ac6f952ap-1;
+	a = v12 - v76;
+	b = v13 - v77;
+	v12 += v76;
+	v13 += v77;
+	v76 = a * 0x1.a29a7a0462782p-1 + b * 0x1.26d054cdd12dfp-1;
+	v77 = a * 0x1.26d054cdd12dfp-1 - b * 0x1.a29a7a0462782p-1;
+	a = v14 - v78;
+	b = v15 - v79;
+	v14 += v78;
+	v15 += v79;
+	v78 = a * 0x1.83b0e0bff976ep-1 + b * 0x1.4e6cabbe3e5e9p-1;
+	v79 = a * 0x1.4e6cabbe3e5e9p-1 - b * 0x1.83b0e0bff976ep-1;
+	a = v16 - v80;
+	b = v17 - v81;
+	v16 += v80;
+	v17 += v81;
+	v80 = a * 0x1.610b7551d2cdfp-1 + b * 0x1.72d0837efff96p-1;
+	v81 = a * 0x1.72d0837efff96p-1 - b * 0x1.610b7551d2cdfp-1;
+	a = v18 - v82;
+	b = v19 - v83;
+	v18 += v82;
+	v19 += v83;
+	v82 = a * 0x1.3affa292050b9p-1 + b * 0x1.93a22499263fbp-1;
+	v83 = a * 0x1.93a22499263fbp-1 - b * 0x1.3affa292050b9p-1;
+	a = v20 - v84;
+	b = v21 - v85;
+	v20 += v84;
+	v21 += v85;
+	v84 = a * 0x1.11eb3541b4b23p-1 + b * 0x1.b090a581501ffp-1;
+	v85 = a * 0x1.b090a581501ffp-1 - b * 0x1.11eb3541b4b23p-1;
+	a = v22 - v86;
+	b = v23 - v87;
+	v22 += v86;
+	v23 += v87;
+	v86 = a * 0x1.cc66e9931c45ep-2 + b * 0x1.c954b213411f5p-1;
+	v87 = a * 0x1.c954b213411f5p-1 - b * 0x1.cc66e9931c45ep-2;
+	a = v24 - v88;
+	b = v25 - v89;
+	v24 += v88;
+	v25 += v89;
+	v88 = a * 0x1.7088530fa45a1p-2 + b * 0x1.ddb13b6ccc23cp-1;
+	v89 = a * 0x1.ddb13b6ccc23cp-1 - b * 0x1.7088530fa45a1p-2;
+	a = v26 - v90;
+	b = v27 - v91;
+	v26 += v90;
+	v27 += v91;
+	v90 = a * 0x1.111d262b1f678p-2 + b * 0x1.ed740e7684963p-1;
+	v91 = a * 0x1.ed740e7684963p-1 - b * 0x1.111d262b1f678p-2;
+	a = v28 - v92;
+	b = v29 - v93;
+	v28 += v92;
+	v29 += v93;
+	v92 = a * 0x1.5e214448b3fcbp-3 + b * 0x1.f8764fa714ba9p-1;
+	v93 = a * 0x1.f8764fa714ba9p-1 - b * 0x1.5e214448b3fcbp-3;
+	a = v30 - v94;
+	b = v31 - v95;
+	v30 += v94;
+	v31 += v95;
+	v94 = a * 0x1.2d52092ce19f8p-4 + b * 0x1.fe9cdad01883ap-1;
+	v95 = a * 0x1.fe9cdad01883ap-1 - b * 0x1.2d52092ce19f8p-4;
+	a = v32 - v96;
+	b = v33 - v97;
+	v32 += v96;
+	v33 += v97;
+	v96 = a * -0x1.92155f7a36654p-6 + b * 0x1.ffd886084cd0dp-1;
+	v97 = a * 0x1.ffd886084cd0dp-1 - b * -0x1.92155f7a36654p-6;
+	a = v34 - v98;
+	b = v35 - v99;
+	v34 += v98;
+	v35 += v99;
+	v98 = a * -0x1.f564e56a9730bp-4 + b * 0x1.fc26470e19fd3p-1;
+	v99 = a * 0x1.fc26470e19fd3p-1 - b * -0x1.f564e56a9730bp-4;
+	a = v36 - v100;
+	b = v37 - v101;
+	v36 += v100;
+	v37 += v101;
+	v100 = a * -0x1.c0b826a7e4f5ep-3 + b * 0x1.f38f3ac64e589p-1;
+	v101 = a * 0x1.f38f3ac64e589p-1 - b * -0x1.c0b826a7e4f5ep-3;
+	a = v38 - v102;
+	b = v39 - v103;
+	v38 += v102;
+	v39 += v103;
+	v102 = a * -0x1.4135c941766p-2 + b * 0x1.e6288ec48e112p-1;
+	v103 = a * 0x1.e6288ec48e112p-1 - b * -0x1.4135c941766p-2;
+	a = v40 - v104;
+	b = v41 - v105;
+	v40 += v104;
+	v41 += v105;
+	v104 = a * -0x1.9ef7943a8ed88p-2 + b * 0x1.d4134d14dc93ap-1;
+	v105 = a * 0x1.d4134d14dc93ap-1 - b * -0x1.9ef7943a8ed88p-2;
+	a = v42 - v106;
+	b = v43 - v107;
+	v42 += v106;
+	v43 += v107;
+	v106 = a * -0x1.f8ba4dbf89ab9p-2 + b * 0x1.bd7c0ac6f952ap-1;
+	v107 = a * 0x1.bd7c0ac6f952ap-1 - b * -0x1.f8ba4dbf89ab9p-2;
+	a = v44 - v108;
+	b = v45 - v109;
+	v44 += v108;
+	v45 += v109;
+	v108 = a * -0x1.26d054cdd12dfp-1 + b * 0x1.a29a7a0462782p-1;
+	v109 = a * 0x1.a29a7a0462782p-1 - b * -0x1.26d054cdd12dfp-1;
+	a = v46 - v110;
+	b = v47 - v111;
+	v46 += v110;
+	v47 += v111;
+	v110 = a * -0x1.4e6cabbe3e5e7p-1 + b * 0x1.83b0e0bff976fp-1;
+	v111 = a * 0x1.83b0e0bff976fp-1 - b * -0x1.4e6cabbe3e5e7p-1;
+	a = v48 - v112;
+	b = v49 - v113;
+	v48 += v112;
+	v49 += v113;
+	v112 = a * -0x1.72d0837efff95p-1 + b * 0x1.610b7551d2cep-1;
+	v113 = a * 0x1.610b7551d2cep-1 - b * -0x1.72d0837efff95p-1;
+	a = v50 - v114;
+	b = v51 - v115;
+	v50 += v114;
+	v51 += v115;
+	v114 = a * -0x1.93a22499263fbp-1 + b * 0x1.3affa292050bap-1;
+	v115 = a * 0x1.3affa292050bap-1 - b * -0x1.93a22499263fbp-1;
+	a = v52 - v116;
+	b = v53 - v117;
+	v52 += v116;
+	v53 += v117;
+	v116 = a * -0x1.b090a581502p-1 + b * 0x1.11eb3541b4b22p-1;
+	v117 = a * 0x1.11eb3541b4b22p-1 - b * -0x1.b090a581502p-1;
+	a = v54 - v118;
+	b = v55 - v119;
+	v54 += v118;
+	v55 += v119;
+	v118 = a * -0x1.c954b213411f4p-1 + b * 0x1.cc66e9931c463p-2;
+	v119 = a * 0x1.cc66e9931c463p-2 - b * -0x1.c954b213411f4p-1;
+	a = v56 - v120;
+	b = v57 - v121;
+	v56 += v120;
+	v57 += v121;
+	v120 = a * -0x1.ddb13b6ccc23cp-1 + b * 0x1.7088530fa45a2p-2;
+	v121 = a * 0x1.7088530fa45a2p-2 - b * -0x1.ddb13b6ccc23cp-1;
+	a = v58 - v122;
+	b = v59 - v123;
+	v58 += v122;
+	v59 += v123;
+	v122 = a * -0x1.ed740e7684963p-1 + b * 0x1.111d262b1f679p-2;
+	v123 = a * 0x1.111d262b1f679p-2 - b * -0x1.ed740e7684963p-1;
+	a = v60 - v124;
+	b = v61 - v125;
+	v60 += v124;
+	v61 += v125;
+	v124 = a * -0x1.f8764fa714ba9p-1 + b * 0x1.5e214448b3fc6p-3;
+	v125 = a * 0x1.5e214448b3fc6p-3 - b * -0x1.f8764fa714ba9p-1;
+	a = v62 - v126;
+	b = v63 - v127;
+	v62 += v126;
+	v63 += v127;
+	v126 = a * -0x1.fe9cdad01883ap-1 + b * 0x1.2d52092ce1a0cp-4;
+	v127 = a * 0x1.2d52092ce1a0cp-4 - b * -0x1.fe9cdad01883ap-1;
+	a = v0 - v32;
+	b = v1 - v33;
+	v0 += v32;
+	v1 += v33;
+	v32 = a * 0x1.ff621e3796d7ep-1 + b * 0x1.91f65f10dd814p-5;
+	v33 = a * 0x1.91f65f10dd814p-5 - b * 0x1.ff621e3796d7ep-1;
+	a = v2 - v34;
+	b = v3 - v35;
+	v2 += v34;
+	v3 += v35;
+	v34 = a * 0x1.f0a7efb9230d7p-1 + b * 0x1.f19f97b215f1ap-3;
+	v35 = a * 0x1.f19f97b215f1ap-3 - b * 0x1.f0a7efb9230d7p-1;
+	a = v4 - v36;
+	b = v5 - v37;
+	v4 += v36;
+	v5 += v37;
+	v36 = a * 0x1.ced7af43cc773p-1 + b * 0x1.b5d1009e15ccp-2;
+	v37 = a * 0x1.b5d1009e15ccp-2 - b * 0x1.ced7af43cc773p-1;
+	a = v6 - v38;
+	b = v7 - v39;
+	v6 += v38;
+	v7 += v39;
+	v38 = a * 0x1.9b3e047f38741p-1 + b * 0x1.30ff7fce17035p-1;
+	v39 = a * 0x1.30ff7fce17035p-1 - b * 0x1.9b3e047f38741p-1;
+	a = v8 - v40;
+	b = v9 - v41;
+	v8 += v40;
+	v9 += v41;
+	v40 = a * 0x1.57d69348cec9fp-1 + b * 0x1.7b5df226aafafp-1;
+	v41 = a * 0x1.7b5df226aafafp-1 - b * 0x1.57d69348cec9fp-1;
+	a = v10 - v42;
+	b = v11 - v43;
+	v10 += v42;
+	v11 += v43;
+	v42 = a * 0x1.073879922ffedp-1 + b * 0x1.b728345196e3ep-1;
+	v43 = a * 0x1.b728345196e3ep-1 - b * 0x1.073879922ffedp-1;
+	a = v12 - v44;
+	b = v13 - v45;
+	v12 += v44;
+	v13 += v45;
+	v44 = a * 0x1.58f9a75ab1fddp-2 + b * 0x1.e212104f686e5p-1;
+	v45 = a * 0x1.e212104f686e5p-1 - b * 0x1.58f9a75ab1fddp-2;
+	a = v14 - v46;
+	b = v15 - v47;
+	v14 += v46;
+	v15 += v47;
+	v46 = a * 0x1.2c8106e8e613ap-3 + b * 0x1.fa7557f08a517p-1;
+	v47 = a * 0x1.fa7557f08a517p-1 - b * 0x1.2c8106e8e613ap-3;
+	a = v16 - v48;
+	b = v17 - v49;
+	v16 += v48;
+	v17 += v49;
+	v48 = a * -0x1.91f65f10dd813p-5 + b * 0x1.ff621e3796d7ep-1;
+	v49 = a * 0x1.ff621e3796d7ep-1 - b * -0x1.91f65f10dd813p-5;
+	a = v18 - v50;
+	b = v19 - v51;
+	v18 += v50;
+	v19 += v51;
+	v50 = a * -0x1.f19f97b215f1ap-3 + b * 0x1.f0a7efb9230d7p-1;
+	v51 = a * 0x1.f0a7efb9230d7p-1 - b * -0x1.f19f97b215f1ap-3;
+	a = v20 - v52;
+	b = v21 - v53;
+	v20 += v52;
+	v21 += v53;
+	v52 = a * -0x1.b5d1009e15cbcp-2 + b * 0x1.ced7af43cc774p-1;
+	v53 = a * 0x1.ced7af43cc774p-1 - b * -0x1.b5d1009e15cbcp-2;
+	a = v22 - v54;
+	b = v23 - v55;
+	v22 += v54;
+	v23 += v55;
+	v54 = a * -0x1.30ff7fce17035p-1 + b * 0x1.9b3e047f38741p-1;
+	v55 = a * 0x1.9b3e047f38741p-1 - b * -0x1.30ff7fce17035p-1;
+	a = v24 - v56;
+	b = v25 - v57;
+	v24 += v56;
+	v25 += v57;
+	v56 = a * -0x1.7b5df226aafadp-1 + b * 0x1.57d69348ceca1p-1;
+	v57 = a * 0x1.57d69348ceca1p-1 - b * -0x1.7b5df226aafadp-1;
+	a = v26 - v58;
+	b = v27 - v59;
+	v26 += v58;
+	v27 += v59;
+	v58 = a * -0x1.b728345196e3dp-1 + b * 0x1.073879922ffeep-1;
+	v59 = a * 0x1.073879922ffeep-1 - b * -0x1.b728345196e3dp-1;
+	a = v28 - v60;
+	b = v29 - v61;
+	v28 += v60;
+	v29 += v61;
+	v60 = a * -0x1.e212104f686e4p-1 + b * 0x1.58f9a75ab1fe2p-2;
+	v61 = a * 0x1.58f9a75ab1fe2p-2 - b * -0x1.e212104f686e4p-1;
+	a = v30 - v62;
+	b = v31 - v63;
+	v30 += v62;
+	v31 += v63;
+	v62 = a * -0x1.fa7557f08a517p-1 + b * 0x1.2c8106e8e613cp-3;
+	v63 = a * 0x1.2c8106e8e613cp-3 - b * -0x1.fa7557f08a517p-1;
+	a = v64 - v96;
+	b = v65 - v97;
+	v64 += v96;
+	v65 += v97;
+	v96 = a * 0x1.ff621e3796d7ep-1 + b * 0x1.91f65f10dd814p-5;
+	v97 = a * 0x1.91f65f10dd814p-5 - b * 0x1.ff621e3796d7ep-1;
+	a = v66 - v98;
+	b = v67 - v99;
+	v66 += v98;
+	v67 += v99;
+	v98 = a * 0x1.f0a7efb9230d7p-1 + b * 0x1.f19f97b215f1ap-3;
+	v99 = a * 0x1.f19f97b215f1ap-3 - b * 0x1.f0a7efb9230d7p-1;
+	a = v68 - v100;
+	b = v69 - v101;
+	v68 += v100;
+	v69 += v101;
+	v100 = a * 0x1.ced7af43cc773p-1 + b * 0x1.b5d1009e15ccp-2;
+	v101 = a * 0x1.b5d1009e15ccp-2 - b * 0x1.ced7af43cc773p-1;
+	a = v70 - v102;
+	b = v71 - v103;
+	v70 += v102;
+	v71 += v103;
+	v102 = a * 0x1.9b3e047f38741p-1 + b * 0x1.30ff7fce17035p-1;
+	v103 = a * 0x1.30ff7fce17035p-1 - b * 0x1.9b3e047f38741p-1;
+	a = v72 - v104;
+	b = v73 - v105;
+	v72 += v104;
+	v73 += v105;
+	v104 = a * 0x1.57d69348cec9fp-1 + b * 0x1.7b5df226aafafp-1;
+	v105 = a * 0x1.7b5df226aafafp-1 - b * 0x1.57d69348cec9fp-1;
+	a = v74 - v106;
+	b = v75 - v107;
+	v74 += v106;
+	v75 += v107;
+	v106 = a * 0x1.073879922ffedp-1 + b * 0x1.b728345196e3ep-1;
+	v107 = a * 0x1.b728345196e3ep-1 - b * 0x1.073879922ffedp-1;
+	a = v76 - v108;
+	b = v77 - v109;
+	v76 += v108;
+	v77 += v109;
+	v108 = a * 0x1.58f9a75ab1fddp-2 + b * 0x1.e212104f686e5p-1;
+	v109 = a * 0x1.e212104f686e5p-1 - b * 0x1.58f9a75ab1fddp-2;
+	a = v78 - v110;
+	b = v79 - v111;
+	v78 += v110;
+	v79 += v111;
+	v110 = a * 0x1.2c8106e8e613ap-3 + b * 0x1.fa7557f08a517p-1;
+	v111 = a * 0x1.fa7557f08a517p-1 - b * 0x1.2c8106e8e613ap-3;
+	a = v80 - v112;
+	b = v81 - v113;
+	v80 += v112;
+	v81 += v113;
+	v112 = a * -0x1.91f65f10dd813p-5 + b * 0x1.ff621e3796d7ep-1;
+	v113 = a * 0x1.ff621e3796d7ep-1 - b * -0x1.91f65f10dd813p-5;
+	a = v82 - v114;
+	b = v83 - v115;
+	v82 += v114;
+	v83 += v115;
+	v114 = a * -0x1.f19f97b215f1ap-3 + b * 0x1.f0a7efb9230d7p-1;
+	v115 = a * 0x1.f0a7efb9230d7p-1 - b * -0x1.f19f97b215f1ap-3;
+	a = v84 - v116;
+	b = v85 - v117;
+	v84 += v116;
+	v85 += v117;
+	v116 = a * -0x1.b5d1009e15cbcp-2 + b * 0x1.ced7af43cc774p-1;
+	v117 = a * 0x1.ced7af43cc774p-1 - b * -0x1.b5d1009e15cbcp-2;
+	a = v86 - v118;
+	b = v87 - v119;
+	v86 += v118;
+	v87 += v119;
+	v118 = a * -0x1.30ff7fce17035p-1 + b * 0x1.9b3e047f38741p-1;
+	v119 = a * 0x1.9b3e047f38741p-1 - b * -0x1.30ff7fce17035p-1;
+	a = v88 - v120;
+	b = v89 - v121;
+	v88 += v120;
+	v89 += v121;
+	v120 = a * -0x1.7b5df226aafadp-1 + b * 0x1.57d69348ceca1p-1;
+	v121 = a * 0x1.57d69348ceca1p-1 - b * -0x1.7b5df226aafadp-1;
+	a = v90 - v122;
+	b = v91 - v123;
+	v90 += v122;
+	v91 += v123;
+	v122 = a * -0x1.b728345196e3dp-1 + b * 0x1.073879922ffeep-1;
+	v123 = a * 0x1.073879922ffeep-1 - b * -0x1.b728345196e3dp-1;
+	a = v92 - v124;
+	b = v93 - v125;
+	v92 += v124;
+	v93 += v125;
+	v124 = a * -0x1.e212104f686e4p-1 + b * 0x1.58f9a75ab1fe2p-2;
+	v125 = a * 0x1.58f9a75ab1fe2p-2 - b * -0x1.e212104f686e4p-1;
+	a = v94 - v126;
+	b = v95 - v127;
+	v94 += v126;
+	v95 += v127;
+	v126 = a * -0x1.fa7557f08a517p-1 + b * 0x1.2c8106e8e613cp-3;
+	v127 = a * 0x1.2c8106e8e613cp-3 - b * -0x1.fa7557f08a517p-1;
+	a = v0 - v16;
+	b = v1 - v17;
+	v0 += v16;
+	v1 += v17;
+	v16 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v17 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v2 - v18;
+	b = v3 - v19;
+	v2 += v18;
+	v3 += v19;
+	v18 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v19 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v4 - v20;
+	b = v5 - v21;
+	v4 += v20;
+	v5 += v21;
+	v20 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v21 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v6 - v22;
+	b = v7 - v23;
+	v6 += v22;
+	v7 += v23;
+	v22 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v23 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v8 - v24;
+	b = v9 - v25;
+	v8 += v24;
+	v9 += v25;
+	v24 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v25 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v10 - v26;
+	b = v11 - v27;
+	v10 += v26;
+	v11 += v27;
+	v26 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v27 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v12 - v28;
+	b = v13 - v29;
+	v12 += v28;
+	v13 += v29;
+	v28 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v29 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v14 - v30;
+	b = v15 - v31;
+	v14 += v30;
+	v15 += v31;
+	v30 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v31 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v32 - v48;
+	b = v33 - v49;
+	v32 += v48;
+	v33 += v49;
+	v48 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v49 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v34 - v50;
+	b = v35 - v51;
+	v34 += v50;
+	v35 += v51;
+	v50 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v51 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v36 - v52;
+	b = v37 - v53;
+	v36 += v52;
+	v37 += v53;
+	v52 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v53 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v38 - v54;
+	b = v39 - v55;
+	v38 += v54;
+	v39 += v55;
+	v54 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v55 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v40 - v56;
+	b = v41 - v57;
+	v40 += v56;
+	v41 += v57;
+	v56 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v57 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v42 - v58;
+	b = v43 - v59;
+	v42 += v58;
+	v43 += v59;
+	v58 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v59 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v44 - v60;
+	b = v45 - v61;
+	v44 += v60;
+	v45 += v61;
+	v60 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v61 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v46 - v62;
+	b = v47 - v63;
+	v46 += v62;
+	v47 += v63;
+	v62 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v63 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v64 - v80;
+	b = v65 - v81;
+	v64 += v80;
+	v65 += v81;
+	v80 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v81 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v66 - v82;
+	b = v67 - v83;
+	v66 += v82;
+	v67 += v83;
+	v82 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v83 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v68 - v84;
+	b = v69 - v85;
+	v68 += v84;
+	v69 += v85;
+	v84 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v85 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v70 - v86;
+	b = v71 - v87;
+	v70 += v86;
+	v71 += v87;
+	v86 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v87 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v72 - v88;
+	b = v73 - v89;
+	v72 += v88;
+	v73 += v89;
+	v88 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v89 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v74 - v90;
+	b = v75 - v91;
+	v74 += v90;
+	v75 += v91;
+	v90 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v91 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v76 - v92;
+	b = v77 - v93;
+	v76 += v92;
+	v77 += v93;
+	v92 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v93 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v78 - v94;
+	b = v79 - v95;
+	v78 += v94;
+	v79 += v95;
+	v94 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v95 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v96 - v112;
+	b = v97 - v113;
+	v96 += v112;
+	v97 += v113;
+	v112 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v113 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v98 - v114;
+	b = v99 - v115;
+	v98 += v114;
+	v99 += v115;
+	v114 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v115 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v100 - v116;
+	b = v101 - v117;
+	v100 += v116;
+	v101 += v117;
+	v116 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v117 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v102 - v118;
+	b = v103 - v119;
+	v102 += v118;
+	v103 += v119;
+	v118 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v119 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v104 - v120;
+	b = v105 - v121;
+	v104 += v120;
+	v105 += v121;
+	v120 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v121 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v106 - v122;
+	b = v107 - v123;
+	v106 += v122;
+	v107 += v123;
+	v122 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v123 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v108 - v124;
+	b = v109 - v125;
+	v108 += v124;
+	v109 += v125;
+	v124 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v125 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v110 - v126;
+	b = v111 - v127;
+	v110 += v126;
+	v111 += v127;
+	v126 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v127 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v0 - v8;
+	b = v1 - v9;
+	v0 += v8;
+	v1 += v9;
+	v8 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v9 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v2 - v10;
+	b = v3 - v11;
+	v2 += v10;
+	v3 += v11;
+	v10 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v11 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v4 - v12;
+	b = v5 - v13;
+	v4 += v12;
+	v5 += v13;
+	v12 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v13 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v6 - v14;
+	b = v7 - v15;
+	v6 += v14;
+	v7 += v15;
+	v14 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v15 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v16 - v24;
+	b = v17 - v25;
+	v16 += v24;
+	v17 += v25;
+	v24 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v25 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v18 - v26;
+	b = v19 - v27;
+	v18 += v26;
+	v19 += v27;
+	v26 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v27 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v20 - v28;
+	b = v21 - v29;
+	v20 += v28;
+	v21 += v29;
+	v28 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v29 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v22 - v30;
+	b = v23 - v31;
+	v22 += v30;
+	v23 += v31;
+	v30 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v31 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v32 - v40;
+	b = v33 - v41;
+	v32 += v40;
+	v33 += v41;
+	v40 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v41 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v34 - v42;
+	b = v35 - v43;
+	v34 += v42;
+	v35 += v43;
+	v42 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v43 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v36 - v44;
+	b = v37 - v45;
+	v36 += v44;
+	v37 += v45;
+	v44 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v45 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v38 - v46;
+	b = v39 - v47;
+	v38 += v46;
+	v39 += v47;
+	v46 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v47 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v48 - v56;
+	b = v49 - v57;
+	v48 += v56;
+	v49 += v57;
+	v56 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v57 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v50 - v58;
+	b = v51 - v59;
+	v50 += v58;
+	v51 += v59;
+	v58 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v59 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v52 - v60;
+	b = v53 - v61;
+	v52 += v60;
+	v53 += v61;
+	v60 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v61 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v54 - v62;
+	b = v55 - v63;
+	v54 += v62;
+	v55 += v63;
+	v62 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v63 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v64 - v72;
+	b = v65 - v73;
+	v64 += v72;
+	v65 += v73;
+	v72 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v73 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v66 - v74;
+	b = v67 - v75;
+	v66 += v74;
+	v67 += v75;
+	v74 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v75 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v68 - v76;
+	b = v69 - v77;
+	v68 += v76;
+	v69 += v77;
+	v76 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v77 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v70 - v78;
+	b = v71 - v79;
+	v70 += v78;
+	v71 += v79;
+	v78 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v79 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v80 - v88;
+	b = v81 - v89;
+	v80 += v88;
+	v81 += v89;
+	v88 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v89 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v82 - v90;
+	b = v83 - v91;
+	v82 += v90;
+	v83 += v91;
+	v90 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v91 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v84 - v92;
+	b = v85 - v93;
+	v84 += v92;
+	v85 += v93;
+	v92 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v93 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v86 - v94;
+	b = v87 - v95;
+	v86 += v94;
+	v87 += v95;
+	v94 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v95 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v96 - v104;
+	b = v97 - v105;
+	v96 += v104;
+	v97 += v105;
+	v104 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v105 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v98 - v106;
+	b = v99 - v107;
+	v98 += v106;
+	v99 += v107;
+	v106 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v107 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v100 - v108;
+	b = v101 - v109;
+	v100 += v108;
+	v101 += v109;
+	v108 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v109 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v102 - v110;
+	b = v103 - v111;
+	v102 += v110;
+	v103 += v111;
+	v110 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v111 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v112 - v120;
+	b = v113 - v121;
+	v112 += v120;
+	v113 += v121;
+	v120 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v121 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v114 - v122;
+	b = v115 - v123;
+	v114 += v122;
+	v115 += v123;
+	v122 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v123 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v116 - v124;
+	b = v117 - v125;
+	v116 += v124;
+	v117 += v125;
+	v124 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v125 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v118 - v126;
+	b = v119 - v127;
+	v118 += v126;
+	v119 += v127;
+	v126 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v127 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v0 - v4;
+	b = v1 - v5;
+	v0 += v4;
+	v1 += v5;
+	v4 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v5 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v2 - v6;
+	b = v3 - v7;
+	v2 += v6;
+	v3 += v7;
+	v6 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v7 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v0 - v2;
+	b = v1 - v3;
+	v0 += v2;
+	v1 += v3;
+	v2 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v3 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v4 - v6;
+	b = v5 - v7;
+	v4 += v6;
+	v5 += v7;
+	v6 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v7 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[0] = v0;
+	output[127] = v1;
+	output[63] = v2;
+	output[64] = v3;
+	output[31] = v4;
+	output[96] = v5;
+	output[32] = v6;
+	output[95] = v7;
+	a = v8 - v12;
+	b = v9 - v13;
+	v8 += v12;
+	v9 += v13;
+	v12 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v13 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v10 - v14;
+	b = v11 - v15;
+	v10 += v14;
+	v11 += v15;
+	v14 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v15 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v8 - v10;
+	b = v9 - v11;
+	v8 += v10;
+	v9 += v11;
+	v10 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v11 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v12 - v14;
+	b = v13 - v15;
+	v12 += v14;
+	v13 += v15;
+	v14 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v15 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[15] = v8;
+	output[112] = v9;
+	output[48] = v10;
+	output[79] = v11;
+	output[16] = v12;
+	output[111] = v13;
+	output[47] = v14;
+	output[80] = v15;
+	a = v16 - v20;
+	b = v17 - v21;
+	v16 += v20;
+	v17 += v21;
+	v20 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v21 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v18 - v22;
+	b = v19 - v23;
+	v18 += v22;
+	v19 += v23;
+	v22 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v23 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v16 - v18;
+	b = v17 - v19;
+	v16 += v18;
+	v17 += v19;
+	v18 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v19 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v20 - v22;
+	b = v21 - v23;
+	v20 += v22;
+	v21 += v23;
+	v22 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v23 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[7] = v16;
+	output[120] = v17;
+	output[56] = v18;
+	output[71] = v19;
+	output[24] = v20;
+	output[103] = v21;
+	output[39] = v22;
+	output[88] = v23;
+	a = v24 - v28;
+	b = v25 - v29;
+	v24 += v28;
+	v25 += v29;
+	v28 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v29 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v26 - v30;
+	b = v27 - v31;
+	v26 += v30;
+	v27 += v31;
+	v30 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v31 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v24 - v26;
+	b = v25 - v27;
+	v24 += v26;
+	v25 += v27;
+	v26 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v27 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v28 - v30;
+	b = v29 - v31;
+	v28 += v30;
+	v29 += v31;
+	v30 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v31 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[8] = v24;
+	output[119] = v25;
+	output[55] = v26;
+	output[72] = v27;
+	output[23] = v28;
+	output[104] = v29;
+	output[40] = v30;
+	output[87] = v31;
+	a = v32 - v36;
+	b = v33 - v37;
+	v32 += v36;
+	v33 += v37;
+	v36 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v37 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v34 - v38;
+	b = v35 - v39;
+	v34 += v38;
+	v35 += v39;
+	v38 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v39 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v32 - v34;
+	b = v33 - v35;
+	v32 += v34;
+	v33 += v35;
+	v34 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v35 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v36 - v38;
+	b = v37 - v39;
+	v36 += v38;
+	v37 += v39;
+	v38 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v39 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[3] = v32;
+	output[124] = v33;
+	output[60] = v34;
+	output[67] = v35;
+	output[28] = v36;
+	output[99] = v37;
+	output[35] = v38;
+	output[92] = v39;
+	a = v40 - v44;
+	b = v41 - v45;
+	v40 += v44;
+	v41 += v45;
+	v44 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v45 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v42 - v46;
+	b = v43 - v47;
+	v42 += v46;
+	v43 += v47;
+	v46 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v47 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v40 - v42;
+	b = v41 - v43;
+	v40 += v42;
+	v41 += v43;
+	v42 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v43 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v44 - v46;
+	b = v45 - v47;
+	v44 += v46;
+	v45 += v47;
+	v46 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v47 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[12] = v40;
+	output[115] = v41;
+	output[51] = v42;
+	output[76] = v43;
+	output[19] = v44;
+	output[108] = v45;
+	output[44] = v46;
+	output[83] = v47;
+	a = v48 - v52;
+	b = v49 - v53;
+	v48 += v52;
+	v49 += v53;
+	v52 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v53 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v50 - v54;
+	b = v51 - v55;
+	v50 += v54;
+	v51 += v55;
+	v54 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v55 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v48 - v50;
+	b = v49 - v51;
+	v48 += v50;
+	v49 += v51;
+	v50 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v51 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v52 - v54;
+	b = v53 - v55;
+	v52 += v54;
+	v53 += v55;
+	v54 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v55 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[4] = v48;
+	output[123] = v49;
+	output[59] = v50;
+	output[68] = v51;
+	output[27] = v52;
+	output[100] = v53;
+	output[36] = v54;
+	output[91] = v55;
+	a = v56 - v60;
+	b = v57 - v61;
+	v56 += v60;
+	v57 += v61;
+	v60 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v61 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v58 - v62;
+	b = v59 - v63;
+	v58 += v62;
+	v59 += v63;
+	v62 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v63 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v56 - v58;
+	b = v57 - v59;
+	v56 += v58;
+	v57 += v59;
+	v58 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v59 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v60 - v62;
+	b = v61 - v63;
+	v60 += v62;
+	v61 += v63;
+	v62 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v63 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[11] = v56;
+	output[116] = v57;
+	output[52] = v58;
+	output[75] = v59;
+	output[20] = v60;
+	output[107] = v61;
+	output[43] = v62;
+	output[84] = v63;
+	a = v64 - v68;
+	b = v65 - v69;
+	v64 += v68;
+	v65 += v69;
+	v68 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v69 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v66 - v70;
+	b = v67 - v71;
+	v66 += v70;
+	v67 += v71;
+	v70 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v71 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v64 - v66;
+	b = v65 - v67;
+	v64 += v66;
+	v65 += v67;
+	v66 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v67 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v68 - v70;
+	b = v69 - v71;
+	v68 += v70;
+	v69 += v71;
+	v70 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v71 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[1] = v64;
+	output[126] = v65;
+	output[62] = v66;
+	output[65] = v67;
+	output[30] = v68;
+	output[97] = v69;
+	output[33] = v70;
+	output[94] = v71;
+	a = v72 - v76;
+	b = v73 - v77;
+	v72 += v76;
+	v73 += v77;
+	v76 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v77 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v74 - v78;
+	b = v75 - v79;
+	v74 += v78;
+	v75 += v79;
+	v78 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v79 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v72 - v74;
+	b = v73 - v75;
+	v72 += v74;
+	v73 += v75;
+	v74 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v75 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v76 - v78;
+	b = v77 - v79;
+	v76 += v78;
+	v77 += v79;
+	v78 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v79 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[14] = v72;
+	output[113] = v73;
+	output[49] = v74;
+	output[78] = v75;
+	output[17] = v76;
+	output[110] = v77;
+	output[46] = v78;
+	output[81] = v79;
+	a = v80 - v84;
+	b = v81 - v85;
+	v80 += v84;
+	v81 += v85;
+	v84 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v85 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v82 - v86;
+	b = v83 - v87;
+	v82 += v86;
+	v83 += v87;
+	v86 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v87 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v80 - v82;
+	b = v81 - v83;
+	v80 += v82;
+	v81 += v83;
+	v82 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v83 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v84 - v86;
+	b = v85 - v87;
+	v84 += v86;
+	v85 += v87;
+	v86 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v87 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[6] = v80;
+	output[121] = v81;
+	output[57] = v82;
+	output[70] = v83;
+	output[25] = v84;
+	output[102] = v85;
+	output[38] = v86;
+	output[89] = v87;
+	a = v88 - v92;
+	b = v89 - v93;
+	v88 += v92;
+	v89 += v93;
+	v92 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v93 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v90 - v94;
+	b = v91 - v95;
+	v90 += v94;
+	v91 += v95;
+	v94 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v95 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v88 - v90;
+	b = v89 - v91;
+	v88 += v90;
+	v89 += v91;
+	v90 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v91 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v92 - v94;
+	b = v93 - v95;
+	v92 += v94;
+	v93 += v95;
+	v94 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v95 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[9] = v88;
+	output[118] = v89;
+	output[54] = v90;
+	output[73] = v91;
+	output[22] = v92;
+	output[105] = v93;
+	output[41] = v94;
+	output[86] = v95;
+	a = v96 - v100;
+	b = v97 - v101;
+	v96 += v100;
+	v97 += v101;
+	v100 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v101 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v98 - v102;
+	b = v99 - v103;
+	v98 += v102;
+	v99 += v103;
+	v102 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v103 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v96 - v98;
+	b = v97 - v99;
+	v96 += v98;
+	v97 += v99;
+	v98 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v99 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v100 - v102;
+	b = v101 - v103;
+	v100 += v102;
+	v101 += v103;
+	v102 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v103 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[2] = v96;
+	output[125] = v97;
+	output[61] = v98;
+	output[66] = v99;
+	output[29] = v100;
+	output[98] = v101;
+	output[34] = v102;
+	output[93] = v103;
+	a = v104 - v108;
+	b = v105 - v109;
+	v104 += v108;
+	v105 += v109;
+	v108 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v109 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v106 - v110;
+	b = v107 - v111;
+	v106 += v110;
+	v107 += v111;
+	v110 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v111 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v104 - v106;
+	b = v105 - v107;
+	v104 += v106;
+	v105 += v107;
+	v106 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v107 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v108 - v110;
+	b = v109 - v111;
+	v108 += v110;
+	v109 += v111;
+	v110 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v111 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[13] = v104;
+	output[114] = v105;
+	output[50] = v106;
+	output[77] = v107;
+	output[18] = v108;
+	output[109] = v109;
+	output[45] = v110;
+	output[82] = v111;
+	a = v112 - v116;
+	b = v113 - v117;
+	v112 += v116;
+	v113 += v117;
+	v116 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v117 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v114 - v118;
+	b = v115 - v119;
+	v114 += v118;
+	v115 += v119;
+	v118 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v119 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v112 - v114;
+	b = v113 - v115;
+	v112 += v114;
+	v113 += v115;
+	v114 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v115 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v116 - v118;
+	b = v117 - v119;
+	v116 += v118;
+	v117 += v119;
+	v118 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v119 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[5] = v112;
+	output[122] = v113;
+	output[58] = v114;
+	output[69] = v115;
+	output[26] = v116;
+	output[101] = v117;
+	output[37] = v118;
+	output[90] = v119;
+	a = v120 - v124;
+	b = v121 - v125;
+	v120 += v124;
+	v121 += v125;
+	v124 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v125 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v122 - v126;
+	b = v123 - v127;
+	v122 += v126;
+	v123 += v127;
+	v126 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v127 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v120 - v122;
+	b = v121 - v123;
+	v120 += v122;
+	v121 += v123;
+	v122 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v123 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v124 - v126;
+	b = v125 - v127;
+	v124 += v126;
+	v125 += v127;
+	v126 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v127 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	output[10] = v120;
+	output[117] = v121;
+	output[53] = v122;
+	output[74] = v123;
+	output[21] = v124;
+	output[106] = v125;
+	output[42] = v126;
+	output[85] = v127;
+}
+
+static void Dct4Stages256Half(const double* block, double* even, double* odd)
+{
+	double a, b;
+	double v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15;
+	double v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31;
+	double v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44, v45, v46, v47;
+	double v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59, v60, v61, v62, v63;
+	double v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74, v75, v76, v77, v78, v79;
+	double v80, v81, v82, v83, v84, v85, v86, v87, v88, v89, v90, v91, v92, v93, v94, v95;
+	double v96, v97, v98, v99, v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110, v111;
+	double v112, v113, v114, v115, v116, v117, v118, v119, v120, v121, v122, v123, v124, v125, v126, v127;
+
+	v0 = block[0];
+	v1 = block[1];
+	v2 = block[2];
+	v3 = block[3];
+	v4 = block[4];
+	v5 = block[5];
+	v6 = block[6];
+	v7 = block[7];
+	v8 = block[8];
+	v9 = block[9];
+	v10 = block[10];
+	v11 = block[11];
+	v12 = block[12];
+	v13 = block[13];
+	v14 = block[14];
+	v15 = block[15];
+	v16 = block[16];
+	v17 = block[17];
+	v18 = block[18];
+	v19 = block[19];
+	v20 = block[20];
+	v21 = block[21];
+	v22 = block[22];
+	v23 = block[23];
+	v24 = block[24];
+	v25 = block[25];
+	v26 = block[26];
+	v27 = block[27];
+	v28 = block[28];
+	v29 = block[29];
+	v30 = block[30];
+	v31 = block[31];
+	v32 = block[32];
+	v33 = block[33];
+	v34 = block[34];
+	v35 = block[35];
+	v36 = block[36];
+	v37 = block[37];
+	v38 = block[38];
+	v39 = block[39];
+	v40 = block[40];
+	v41 = block[41];
+	v42 = block[42];
+	v43 = block[43];
+	v44 = block[44];
+	v45 = block[45];
+	v46 = block[46];
+	v47 = block[47];
+	v48 = block[48];
+	v49 = block[49];
+	v50 = block[50];
+	v51 = block[51];
+	v52 = block[52];
+	v53 = block[53];
+	v54 = block[54];
+	v55 = block[55];
+	v56 = block[56];
+	v57 = block[57];
+	v58 = block[58];
+	v59 = block[59];
+	v60 = block[60];
+	v61 = block[61];
+	v62 = block[62];
+	v63 = block[63];
+	v64 = block[64];
+	v65 = block[65];
+	v66 = block[66];
+	v67 = block[67];
+	v68 = block[68];
+	v69 = block[69];
+	v70 = block[70];
+	v71 = block[71];
+	v72 = block[72];
+	v73 = block[73];
+	v74 = block[74];
+	v75 = block[75];
+	v76 = block[76];
+	v77 = block[77];
+	v78 = block[78];
+	v79 = block[79];
+	v80 = block[80];
+	v81 = block[81];
+	v82 = block[82];
+	v83 = block[83];
+	v84 = block[84];
+	v85 = block[85];
+	v86 = block[86];
+	v87 = block[87];
+	v88 = block[88];
+	v89 = block[89];
+	v90 = block[90];
+	v91 = block[91];
+	v92 = block[92];
+	v93 = block[93];
+	v94 = block[94];
+	v95 = block[95];
+	v96 = block[96];
+	v97 = block[97];
+	v98 = block[98];
+	v99 = block[99];
+	v100 = block[100];
+	v101 = block[101];
+	v102 = block[102];
+	v103 = block[103];
+	v104 = block[104];
+	v105 = block[105];
+	v106 = block[106];
+	v107 = block[107];
+	v108 = block[108];
+	v109 = block[109];
+	v110 = block[110];
+	v111 = block[111];
+	v112 = block[112];
+	v113 = block[113];
+	v114 = block[114];
+	v115 = block[115];
+	v116 = block[116];
+	v117 = block[117];
+	v118 = block[118];
+	v119 = block[119];
+	v120 = block[120];
+	v121 = block[121];
+	v122 = block[122];
+	v123 = block[123];
+	v124 = block[124];
+	v125 = block[125];
+	v126 = block[126];
+	v127 = block[127];
+	a = v0 - v64;
+	b = v1 - v65;
+	v0 += v64;
+	v1 += v65;
+	v64 = a * 0x1.ffd886084cd0dp-1 + b * 0x1.92155f7a3667ep-6;
+	v65 = a * 0x1.92155f7a3667ep-6 - b * 0x1.ffd886084cd0dp-1;
+	a = v2 - v66;
+	b = v3 - v67;
+	v2 += v66;
+	v3 += v67;
+	v66 = a * 0x1.fc26470e19fd3p-1 + b * 0x1.f564e56a9730ep-4;
+	v67 = a * 0x1.f564e56a9730ep-4 - b * 0x1.fc26470e19fd3p-1;
+	a = v4 - v68;
+	b = v5 - v69;
+	v4 += v68;
+	v5 += v69;
+	v68 = a * 0x1.f38f3ac64e589p-1 + b * 0x1.c0b826a7e4f63p-3;
+	v69 = a * 0x1.c0b826a7e4f63p-3 - b * 0x1.f38f3ac64e589p-1;
+	a = v6 - v70;
+	b = v7 - v71;
+	v6 += v70;
+	v7 += v71;
+	v70 = a * 0x1.e6288ec48e112p-1 + b * 0x1.4135c94176602p-2;
+	v71 = a * 0x1.4135c94176602p-2 - b * 0x1.e6288ec48e112p-1;
+	a = v8 - v72;
+	b = v9 - v73;
+	v8 += v72;
+	v9 += v73;
+	v72 = a * 0x1.d4134d14dc93ap-1 + b * 0x1.9ef7943a8ed8ap-2;
+	v73 = a * 0x1.9ef7943a8ed8ap-2 - b * 0x1.d4134d14dc93ap-1;
+	a = v10 - v74;
+	b = v11 - v75;
+	v10 += v74;
+	v11 += v75;
+	v74 = a * 0x1.bd7c0ac6f952ap-1 + b * 0x1.f8ba4dbf89abap-2;
+	v75 = a * 0x1.f8ba4dbf89abap-2 - b * 0x1.bd7c0ac6f952ap-1;
+	a = v12 - v76;
+	b = v13 - v77;
+	v12 += v76;
+	v13 += v77;
+	v76 = a * 0x1.a29a7a0462782p-1 + b * 0x1.26d054cdd12dfp-1;
+	v77 = a * 0x1.26d054cdd12dfp-1 - b * 0x1.a29a7a0462782p-1;
+	a = v14 - v78;
+	b = v15 - v79;
+	v14 += v78;
+	v15 += v79;
+	v78 = a * 0x1.83b0e0bff976ep-1 + b * 0x1.4e6cabbe3e5e9p-1;
+	v79 = a * 0x1.4e6cabbe3e5e9p-1 - b * 0x1.83b0e0bff976ep-1;
+	a = v16 - v80;
+	b = v17 - v81;
+	v16 += v80;
+	v17 += v81;
+	v80 = a * 0x1.610b7551d2cdfp-1 + b * 0x1.72d0837efff96p-1;
+	v81 = a * 0x1.72d0837efff96p-1 - b * 0x1.610b7551d2cdfp-1;
+	a = v18 - v82;
+	b = v19 - v83;
+	v18 += v82;
+	v19 += v83;
+	v82 = a * 0x1.3affa292050b9p-1 + b * 0x1.93a22499263fbp-1;
+	v83 = a * 0x1.93a22499263fbp-1 - b * 0x1.3affa292050b9p-1;
+	a = v20 - v84;
+	b = v21 - v85;
+	v20 += v84;
+	v21 += v85;
+	v84 = a * 0x1.11eb3541b4b23p-1 + b * 0x1.b090a581501ffp-1;
+	v85 = a * 0x1.b090a581501ffp-1 - b * 0x1.11eb3541b4b23p-1;
+	a = v22 - v86;
+	b = v23 - v87;
+	v22 += v86;
+	v23 += v87;
+	v86 = a * 0x1.cc66e9931c45ep-2 + b * 0x1.c954b213411f5p-1;
+	v87 = a * 0x1.c954b213411f5p-1 - b * 0x1.cc66e9931c45ep-2;
+	a = v24 - v88;
+	b = v25 - v89;
+	v24 += v88;
+	v25 += v89;
+	v88 = a * 0x1.7088530fa45a1p-2 + b * 0x1.ddb13b6ccc23cp-1;
+	v89 = a * 0x1.ddb13b6ccc23cp-1 - b * 0x1.7088530fa45a1p-2;
+	a = v26 - v90;
+	b = v27 - v91;
+	v26 += v90;
+	v27 += v91;
+	v90 = a * 0x1.111d262b1f678p-2 + b * 0x1.ed740e7684963p-1;
+	v91 = a * 0x1.ed740e7684963p-1 - b * 0x1.111d262b1f678p-2;
+	a = v28 - v92;
+	b = v29 - v93;
+	v28 += v92;
+	v29 += v93;
+	v92 = a * 0x1.5e214448b3fcbp-3 + b * 0x1.f8764fa714ba9p-1;
+	v93 = a * 0x1.f8764fa714ba9p-1 - b * 0x1.5e214448b3fcbp-3;
+	a = v30 - v94;
+	b = v31 - v95;
+	v30 += v94;
+	v31 += v95;
+	v94 = a * 0x1.2d52092ce19f8p-4 + b * 0x1.fe9cdad01883ap-1;
+	v95 = a * 0x1.fe9cdad01883ap-1 - b * 0x1.2d52092ce19f8p-4;
+	a = v32 - v96;
+	b = v33 - v97;
+	v32 += v96;
+	v33 += v97;
+	v96 = a * -0x1.92155f7a36654p-6 + b * 0x1.ffd886084cd0dp-1;
+	v97 = a * 0x1.ffd886084cd0dp-1 - b * -0x1.92155f7a36654p-6;
+	a = v34 - v98;
+	b = v35 - v99;
+	v34 += v98;
+	v35 += v99;
+	v98 = a * -0x1.f564e56a9730bp-4 + b * 0x1.fc26470e19fd3p-1;
+	v99 = a * 0x1.fc26470e19fd3p-1 - b * -0x1.f564e56a9730bp-4;
+	a = v36 - v100;
+	b = v37 - v101;
+	v36 += v100;
+	v37 += v101;
+	v100 = a * -0x1.c0b826a7e4f5ep-3 + b * 0x1.f38f3ac64e589p-1;
+	v101 = a * 0x1.f38f3ac64e589p-1 - b * -0x1.c0b826a7e4f5ep-3;
+	a = v38 - v102;
+	b = v39 - v103;
+	v38 += v102;
+	v39 += v103;
+	v102 = a * -0x1.4135c941766p-2 + b * 0x1.e6288ec48e112p-1;
+	v103 = a * 0x1.e6288ec48e112p-1 - b * -0x1.4135c941766p-2;
+	a = v40 - v104;
+	b = v41 - v105;
+	v40 += v104;
+	v41 += v105;
+	v104 = a * -0x1.9ef7943a8ed88p-2 + b * 0x1.d4134d14dc93ap-1;
+	v105 = a * 0x1.d4134d14dc93ap-1 - b * -0x1.9ef7943a8ed88p-2;
+	a = v42 - v106;
+	b = v43 - v107;
+	v42 += v106;
+	v43 += v107;
+	v106 = a * -0x1.f8ba4dbf89ab9p-2 + b * 0x1.bd7c0ac6f952ap-1;
+	v107 = a * 0x1.bd7c0ac6f952ap-1 - b * -0x1.f8ba4dbf89ab9p-2;
+	a = v44 - v108;
+	b = v45 - v109;
+	v44 += v108;
+	v45 += v109;
+	v108 = a * -0x1.26d054cdd12dfp-1 + b * 0x1.a29a7a0462782p-1;
+	v109 = a * 0x1.a29a7a0462782p-1 - b * -0x1.26d054cdd12dfp-1;
+	a = v46 - v110;
+	b = v47 - v111;
+	v46 += v110;
+	v47 += v111;
+	v110 = a * -0x1.4e6cabbe3e5e7p-1 + b * 0x1.83b0e0bff976fp-1;
+	v111 = a * 0x1.83b0e0bff976fp-1 - b * -0x1.4e6cabbe3e5e7p-1;
+	a = v48 - v112;
+	b = v49 - v113;
+	v48 += v112;
+	v49 += v113;
+	v112 = a * -0x1.72d0837efff95p-1 + b * 0x1.610b7551d2cep-1;
+	v113 = a * 0x1.610b7551d2cep-1 - b * -0x1.72d0837efff95p-1;
+	a = v50 - v114;
+	b = v51 - v115;
+	v50 += v114;
+	v51 += v115;
+	v114 = a * -0x1.93a22499263fbp-1 + b * 0x1.3affa292050bap-1;
+	v115 = a * 0x1.3affa292050bap-1 - b * -0x1.93a22499263fbp-1;
+	a = v52 - v116;
+	b = v53 - v117;
+	v52 += v116;
+	v53 += v117;
+	v116 = a * -0x1.b090a581502p-1 + b * 0x1.11eb3541b4b22p-1;
+	v117 = a * 0x1.11eb3541b4b22p-1 - b * -0x1.b090a581502p-1;
+	a = v54 - v118;
+	b = v55 - v119;
+	v54 += v118;
+	v55 += v119;
+	v118 = a * -0x1.c954b213411f4p-1 + b * 0x1.cc66e9931c463p-2;
+	v119 = a * 0x1.cc66e9931c463p-2 - b * -0x1.c954b213411f4p-1;
+	a = v56 - v120;
+	b = v57 - v121;
+	v56 += v120;
+	v57 += v121;
+	v120 = a * -0x1.ddb13b6ccc23cp-1 + b * 0x1.7088530fa45a2p-2;
+	v121 = a * 0x1.7088530fa45a2p-2 - b * -0x1.ddb13b6ccc23cp-1;
+	a = v58 - v122;
+	b = v59 - v123;
+	v58 += v122;
+	v59 += v123;
+	v122 = a * -0x1.ed740e7684963p-1 + b * 0x1.111d262b1f679p-2;
+	v123 = a * 0x1.111d262b1f679p-2 - b * -0x1.ed740e7684963p-1;
+	a = v60 - v124;
+	b = v61 - v125;
+	v60 += v124;
+	v61 += v125;
+	v124 = a * -0x1.f8764fa714ba9p-1 + b * 0x1.5e214448b3fc6p-3;
+	v125 = a * 0x1.5e214448b3fc6p-3 - b * -0x1.f8764fa714ba9p-1;
+	a = v62 - v126;
+	b = v63 - v127;
+	v62 += v126;
+	v63 += v127;
+	v126 = a * -0x1.fe9cdad01883ap-1 + b * 0x1.2d52092ce1a0cp-4;
+	v127 = a * 0x1.2d52092ce1a0cp-4 - b * -0x1.fe9cdad01883ap-1;
+	a = v0 - v32;
+	b = v1 - v33;
+	v0 += v32;
+	v1 += v33;
+	v32 = a * 0x1.ff621e3796d7ep-1 + b * 0x1.91f65f10dd814p-5;
+	v33 = a * 0x1.91f65f10dd814p-5 - b * 0x1.ff621e3796d7ep-1;
+	a = v2 - v34;
+	b = v3 - v35;
+	v2 += v34;
+	v3 += v35;
+	v34 = a * 0x1.f0a7efb9230d7p-1 + b * 0x1.f19f97b215f1ap-3;
+	v35 = a * 0x1.f19f97b215f1ap-3 - b * 0x1.f0a7efb9230d7p-1;
+	a = v4 - v36;
+	b = v5 - v37;
+	v4 += v36;
+	v5 += v37;
+	v36 = a * 0x1.ced7af43cc773p-1 + b * 0x1.b5d1009e15ccp-2;
+	v37 = a * 0x1.b5d1009e15ccp-2 - b * 0x1.ced7af43cc773p-1;
+	a = v6 - v38;
+	b = v7 - v39;
+	v6 += v38;
+	v7 += v39;
+	v38 = a * 0x1.9b3e047f38741p-1 + b * 0x1.30ff7fce17035p-1;
+	v39 = a * 0x1.30ff7fce17035p-1 - b * 0x1.9b3e047f38741p-1;
+	a = v8 - v40;
+	b = v9 - v41;
+	v8 += v40;
+	v9 += v41;
+	v40 = a * 0x1.57d69348cec9fp-1 + b * 0x1.7b5df226aafafp-1;
+	v41 = a * 0x1.7b5df226aafafp-1 - b * 0x1.57d69348cec9fp-1;
+	a = v10 - v42;
+	b = v11 - v43;
+	v10 += v42;
+	v11 += v43;
+	v42 = a * 0x1.073879922ffedp-1 + b * 0x1.b728345196e3ep-1;
+	v43 = a * 0x1.b728345196e3ep-1 - b * 0x1.073879922ffedp-1;
+	a = v12 - v44;
+	b = v13 - v45;
+	v12 += v44;
+	v13 += v45;
+	v44 = a * 0x1.58f9a75ab1fddp-2 + b * 0x1.e212104f686e5p-1;
+	v45 = a * 0x1.e212104f686e5p-1 - b * 0x1.58f9a75ab1fddp-2;
+	a = v14 - v46;
+	b = v15 - v47;
+	v14 += v46;
+	v15 += v47;
+	v46 = a * 0x1.2c8106e8e613ap-3 + b * 0x1.fa7557f08a517p-1;
+	v47 = a * 0x1.fa7557f08a517p-1 - b * 0x1.2c8106e8e613ap-3;
+	a = v16 - v48;
+	b = v17 - v49;
+	v16 += v48;
+	v17 += v49;
+	v48 = a * -0x1.91f65f10dd813p-5 + b * 0x1.ff621e3796d7ep-1;
+	v49 = a * 0x1.ff621e3796d7ep-1 - b * -0x1.91f65f10dd813p-5;
+	a = v18 - v50;
+	b = v19 - v51;
+	v18 += v50;
+	v19 += v51;
+	v50 = a * -0x1.f19f97b215f1ap-3 + b * 0x1.f0a7efb9230d7p-1;
+	v51 = a * 0x1.f0a7efb9230d7p-1 - b * -0x1.f19f97b215f1ap-3;
+	a = v20 - v52;
+	b = v21 - v53;
+	v20 += v52;
+	v21 += v53;
+	v52 = a * -0x1.b5d1009e15cbcp-2 + b * 0x1.ced7af43cc774p-1;
+	v53 = a * 0x1.ced7af43cc774p-1 - b * -0x1.b5d1009e15cbcp-2;
+	a = v22 - v54;
+	b = v23 - v55;
+	v22 += v54;
+	v23 += v55;
+	v54 = a * -0x1.30ff7fce17035p-1 + b * 0x1.9b3e047f38741p-1;
+	v55 = a * 0x1.9b3e047f38741p-1 - b * -0x1.30ff7fce17035p-1;
+	a = v24 - v56;
+	b = v25 - v57;
+	v24 += v56;
+	v25 += v57;
+	v56 = a * -0x1.7b5df226aafadp-1 + b * 0x1.57d69348ceca1p-1;
+	v57 = a * 0x1.57d69348ceca1p-1 - b * -0x1.7b5df226aafadp-1;
+	a = v26 - v58;
+	b = v27 - v59;
+	v26 += v58;
+	v27 += v59;
+	v58 = a * -0x1.b728345196e3dp-1 + b * 0x1.073879922ffeep-1;
+	v59 = a * 0x1.073879922ffeep-1 - b * -0x1.b728345196e3dp-1;
+	a = v28 - v60;
+	b = v29 - v61;
+	v28 += v60;
+	v29 += v61;
+	v60 = a * -0x1.e212104f686e4p-1 + b * 0x1.58f9a75ab1fe2p-2;
+	v61 = a * 0x1.58f9a75ab1fe2p-2 - b * -0x1.e212104f686e4p-1;
+	a = v30 - v62;
+	b = v31 - v63;
+	v30 += v62;
+	v31 += v63;
+	v62 = a * -0x1.fa7557f08a517p-1 + b * 0x1.2c8106e8e613cp-3;
+	v63 = a * 0x1.2c8106e8e613cp-3 - b * -0x1.fa7557f08a517p-1;
+	a = v64 - v96;
+	b = v65 - v97;
+	v64 += v96;
+	v65 += v97;
+	v96 = a * 0x1.ff621e3796d7ep-1 + b * 0x1.91f65f10dd814p-5;
+	v97 = a * 0x1.91f65f10dd814p-5 - b * 0x1.ff621e3796d7ep-1;
+	a = v66 - v98;
+	b = v67 - v99;
+	v66 += v98;
+	v67 += v99;
+	v98 = a * 0x1.f0a7efb9230d7p-1 + b * 0x1.f19f97b215f1ap-3;
+	v99 = a * 0x1.f19f97b215f1ap-3 - b * 0x1.f0a7efb9230d7p-1;
+	a = v68 - v100;
+	b = v69 - v101;
+	v68 += v100;
+	v69 += v101;
+	v100 = a * 0x1.ced7af43cc773p-1 + b * 0x1.b5d1009e15ccp-2;
+	v101 = a * 0x1.b5d1009e15ccp-2 - b * 0x1.ced7af43cc773p-1;
+	a = v70 - v102;
+	b = v71 - v103;
+	v70 += v102;
+	v71 += v103;
+	v102 = a * 0x1.9b3e047f38741p-1 + b * 0x1.30ff7fce17035p-1;
+	v103 = a * 0x1.30ff7fce17035p-1 - b * 0x1.9b3e047f38741p-1;
+	a = v72 - v104;
+	b = v73 - v105;
+	v72 += v104;
+	v73 += v105;
+	v104 = a * 0x1.57d69348cec9fp-1 + b * 0x1.7b5df226aafafp-1;
+	v105 = a * 0x1.7b5df226aafafp-1 - b * 0x1.57d69348cec9fp-1;
+	a = v74 - v106;
+	b = v75 - v107;
+	v74 += v106;
+	v75 += v107;
+	v106 = a * 0x1.073879922ffedp-1 + b * 0x1.b728345196e3ep-1;
+	v107 = a * 0x1.b728345196e3ep-1 - b * 0x1.073879922ffedp-1;
+	a = v76 - v108;
+	b = v77 - v109;
+	v76 += v108;
+	v77 += v109;
+	v108 = a * 0x1.58f9a75ab1fddp-2 + b * 0x1.e212104f686e5p-1;
+	v109 = a * 0x1.e212104f686e5p-1 - b * 0x1.58f9a75ab1fddp-2;
+	a = v78 - v110;
+	b = v79 - v111;
+	v78 += v110;
+	v79 += v111;
+	v110 = a * 0x1.2c8106e8e613ap-3 + b * 0x1.fa7557f08a517p-1;
+	v111 = a * 0x1.fa7557f08a517p-1 - b * 0x1.2c8106e8e613ap-3;
+	a = v80 - v112;
+	b = v81 - v113;
+	v80 += v112;
+	v81 += v113;
+	v112 = a * -0x1.91f65f10dd813p-5 + b * 0x1.ff621e3796d7ep-1;
+	v113 = a * 0x1.ff621e3796d7ep-1 - b * -0x1.91f65f10dd813p-5;
+	a = v82 - v114;
+	b = v83 - v115;
+	v82 += v114;
+	v83 += v115;
+	v114 = a * -0x1.f19f97b215f1ap-3 + b * 0x1.f0a7efb9230d7p-1;
+	v115 = a * 0x1.f0a7efb9230d7p-1 - b * -0x1.f19f97b215f1ap-3;
+	a = v84 - v116;
+	b = v85 - v117;
+	v84 += v116;
+	v85 += v117;
+	v116 = a * -0x1.b5d1009e15cbcp-2 + b * 0x1.ced7af43cc774p-1;
+	v117 = a * 0x1.ced7af43cc774p-1 - b * -0x1.b5d1009e15cbcp-2;
+	a = v86 - v118;
+	b = v87 - v119;
+	v86 += v118;
+	v87 += v119;
+	v118 = a * -0x1.30ff7fce17035p-1 + b * 0x1.9b3e047f38741p-1;
+	v119 = a * 0x1.9b3e047f38741p-1 - b * -0x1.30ff7fce17035p-1;
+	a = v88 - v120;
+	b = v89 - v121;
+	v88 += v120;
+	v89 += v121;
+	v120 = a * -0x1.7b5df226aafadp-1 + b * 0x1.57d69348ceca1p-1;
+	v121 = a * 0x1.57d69348ceca1p-1 - b * -0x1.7b5df226aafadp-1;
+	a = v90 - v122;
+	b = v91 - v123;
+	v90 += v122;
+	v91 += v123;
+	v122 = a * -0x1.b728345196e3dp-1 + b * 0x1.073879922ffeep-1;
+	v123 = a * 0x1.073879922ffeep-1 - b * -0x1.b728345196e3dp-1;
+	a = v92 - v124;
+	b = v93 - v125;
+	v92 += v124;
+	v93 += v125;
+	v124 = a * -0x1.e212104f686e4p-1 + b * 0x1.58f9a75ab1fe2p-2;
+	v125 = a * 0x1.58f9a75ab1fe2p-2 - b * -0x1.e212104f686e4p-1;
+	a = v94 - v126;
+	b = v95 - v127;
+	v94 += v126;
+	v95 += v127;
+	v126 = a * -0x1.fa7557f08a517p-1 + b * 0x1.2c8106e8e613cp-3;
+	v127 = a * 0x1.2c8106e8e613cp-3 - b * -0x1.fa7557f08a517p-1;
+	a = v0 - v16;
+	b = v1 - v17;
+	v0 += v16;
+	v1 += v17;
+	v16 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v17 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v2 - v18;
+	b = v3 - v19;
+	v2 += v18;
+	v3 += v19;
+	v18 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v19 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v4 - v20;
+	b = v5 - v21;
+	v4 += v20;
+	v5 += v21;
+	v20 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v21 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v6 - v22;
+	b = v7 - v23;
+	v6 += v22;
+	v7 += v23;
+	v22 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v23 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v8 - v24;
+	b = v9 - v25;
+	v8 += v24;
+	v9 += v25;
+	v24 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v25 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v10 - v26;
+	b = v11 - v27;
+	v10 += v26;
+	v11 += v27;
+	v26 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v27 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v12 - v28;
+	b = v13 - v29;
+	v12 += v28;
+	v13 += v29;
+	v28 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v29 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v14 - v30;
+	b = v15 - v31;
+	v14 += v30;
+	v15 += v31;
+	v30 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v31 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v32 - v48;
+	b = v33 - v49;
+	v32 += v48;
+	v33 += v49;
+	v48 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v49 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v34 - v50;
+	b = v35 - v51;
+	v34 += v50;
+	v35 += v51;
+	v50 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v51 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v36 - v52;
+	b = v37 - v53;
+	v36 += v52;
+	v37 += v53;
+	v52 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v53 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v38 - v54;
+	b = v39 - v55;
+	v38 += v54;
+	v39 += v55;
+	v54 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v55 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v40 - v56;
+	b = v41 - v57;
+	v40 += v56;
+	v41 += v57;
+	v56 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v57 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v42 - v58;
+	b = v43 - v59;
+	v42 += v58;
+	v43 += v59;
+	v58 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v59 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v44 - v60;
+	b = v45 - v61;
+	v44 += v60;
+	v45 += v61;
+	v60 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v61 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v46 - v62;
+	b = v47 - v63;
+	v46 += v62;
+	v47 += v63;
+	v62 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v63 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v64 - v80;
+	b = v65 - v81;
+	v64 += v80;
+	v65 += v81;
+	v80 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v81 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v66 - v82;
+	b = v67 - v83;
+	v66 += v82;
+	v67 += v83;
+	v82 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v83 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v68 - v84;
+	b = v69 - v85;
+	v68 += v84;
+	v69 += v85;
+	v84 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v85 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v70 - v86;
+	b = v71 - v87;
+	v70 += v86;
+	v71 += v87;
+	v86 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v87 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v72 - v88;
+	b = v73 - v89;
+	v72 += v88;
+	v73 += v89;
+	v88 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v89 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v74 - v90;
+	b = v75 - v91;
+	v74 += v90;
+	v75 += v91;
+	v90 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v91 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v76 - v92;
+	b = v77 - v93;
+	v76 += v92;
+	v77 += v93;
+	v92 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v93 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v78 - v94;
+	b = v79 - v95;
+	v78 += v94;
+	v79 += v95;
+	v94 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v95 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v96 - v112;
+	b = v97 - v113;
+	v96 += v112;
+	v97 += v113;
+	v112 = a * 0x1.fd88da3d12526p-1 + b * 0x1.917a6bc29b42cp-4;
+	v113 = a * 0x1.917a6bc29b42cp-4 - b * 0x1.fd88da3d12526p-1;
+	a = v98 - v114;
+	b = v99 - v115;
+	v98 += v114;
+	v99 += v115;
+	v114 = a * 0x1.c38b2f180bdb1p-1 + b * 0x1.e2b5d3806f63bp-2;
+	v115 = a * 0x1.e2b5d3806f63bp-2 - b * 0x1.c38b2f180bdb1p-1;
+	a = v100 - v116;
+	b = v101 - v117;
+	v100 += v116;
+	v101 += v117;
+	v116 = a * 0x1.44cf325091dd6p-1 + b * 0x1.8bc806b151741p-1;
+	v117 = a * 0x1.8bc806b151741p-1 - b * 0x1.44cf325091dd6p-1;
+	a = v102 - v118;
+	b = v103 - v119;
+	v102 += v118;
+	v103 += v119;
+	v118 = a * 0x1.294062ed59f05p-2 + b * 0x1.e9f4156c62ddbp-1;
+	v119 = a * 0x1.e9f4156c62ddbp-1 - b * 0x1.294062ed59f05p-2;
+	a = v104 - v120;
+	b = v105 - v121;
+	v104 += v120;
+	v105 += v121;
+	v120 = a * -0x1.917a6bc29b42fp-4 + b * 0x1.fd88da3d12526p-1;
+	v121 = a * 0x1.fd88da3d12526p-1 - b * -0x1.917a6bc29b42fp-4;
+	a = v106 - v122;
+	b = v107 - v123;
+	v106 += v122;
+	v107 += v123;
+	v122 = a * -0x1.e2b5d3806f63cp-2 + b * 0x1.c38b2f180bdb1p-1;
+	v123 = a * 0x1.c38b2f180bdb1p-1 - b * -0x1.e2b5d3806f63cp-2;
+	a = v108 - v124;
+	b = v109 - v125;
+	v108 += v124;
+	v109 += v125;
+	v124 = a * -0x1.8bc806b151741p-1 + b * 0x1.44cf325091dd6p-1;
+	v125 = a * 0x1.44cf325091dd6p-1 - b * -0x1.8bc806b151741p-1;
+	a = v110 - v126;
+	b = v111 - v127;
+	v110 += v126;
+	v111 += v127;
+	v126 = a * -0x1.e9f4156c62ddap-1 + b * 0x1.294062ed59f06p-2;
+	v127 = a * 0x1.294062ed59f06p-2 - b * -0x1.e9f4156c62ddap-1;
+	a = v0 - v8;
+	b = v1 - v9;
+	v0 += v8;
+	v1 += v9;
+	v8 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v9 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v2 - v10;
+	b = v3 - v11;
+	v2 += v10;
+	v3 += v11;
+	v10 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v11 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v4 - v12;
+	b = v5 - v13;
+	v4 += v12;
+	v5 += v13;
+	v12 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v13 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v6 - v14;
+	b = v7 - v15;
+	v6 += v14;
+	v7 += v15;
+	v14 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v15 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v16 - v24;
+	b = v17 - v25;
+	v16 += v24;
+	v17 += v25;
+	v24 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v25 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v18 - v26;
+	b = v19 - v27;
+	v18 += v26;
+	v19 += v27;
+	v26 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v27 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v20 - v28;
+	b = v21 - v29;
+	v20 += v28;
+	v21 += v29;
+	v28 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v29 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v22 - v30;
+	b = v23 - v31;
+	v22 += v30;
+	v23 += v31;
+	v30 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v31 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v32 - v40;
+	b = v33 - v41;
+	v32 += v40;
+	v33 += v41;
+	v40 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v41 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v34 - v42;
+	b = v35 - v43;
+	v34 += v42;
+	v35 += v43;
+	v42 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v43 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v36 - v44;
+	b = v37 - v45;
+	v36 += v44;
+	v37 += v45;
+	v44 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v45 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v38 - v46;
+	b = v39 - v47;
+	v38 += v46;
+	v39 += v47;
+	v46 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v47 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v48 - v56;
+	b = v49 - v57;
+	v48 += v56;
+	v49 += v57;
+	v56 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v57 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v50 - v58;
+	b = v51 - v59;
+	v50 += v58;
+	v51 += v59;
+	v58 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v59 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v52 - v60;
+	b = v53 - v61;
+	v52 += v60;
+	v53 += v61;
+	v60 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v61 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v54 - v62;
+	b = v55 - v63;
+	v54 += v62;
+	v55 += v63;
+	v62 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v63 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v64 - v72;
+	b = v65 - v73;
+	v64 += v72;
+	v65 += v73;
+	v72 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v73 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v66 - v74;
+	b = v67 - v75;
+	v66 += v74;
+	v67 += v75;
+	v74 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v75 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v68 - v76;
+	b = v69 - v77;
+	v68 += v76;
+	v69 += v77;
+	v76 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v77 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v70 - v78;
+	b = v71 - v79;
+	v70 += v78;
+	v71 += v79;
+	v78 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v79 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v80 - v88;
+	b = v81 - v89;
+	v80 += v88;
+	v81 += v89;
+	v88 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v89 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v82 - v90;
+	b = v83 - v91;
+	v82 += v90;
+	v83 += v91;
+	v90 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v91 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v84 - v92;
+	b = v85 - v93;
+	v84 += v92;
+	v85 += v93;
+	v92 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v93 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v86 - v94;
+	b = v87 - v95;
+	v86 += v94;
+	v87 += v95;
+	v94 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v95 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v96 - v104;
+	b = v97 - v105;
+	v96 += v104;
+	v97 += v105;
+	v104 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v105 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v98 - v106;
+	b = v99 - v107;
+	v98 += v106;
+	v99 += v107;
+	v106 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v107 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v100 - v108;
+	b = v101 - v109;
+	v100 += v108;
+	v101 += v109;
+	v108 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v109 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v102 - v110;
+	b = v103 - v111;
+	v102 += v110;
+	v103 += v111;
+	v110 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v111 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v112 - v120;
+	b = v113 - v121;
+	v112 += v120;
+	v113 += v121;
+	v120 = a * 0x1.f6297cff75cbp-1 + b * 0x1.8f8b83c69a60ap-3;
+	v121 = a * 0x1.8f8b83c69a60ap-3 - b * 0x1.f6297cff75cbp-1;
+	a = v114 - v122;
+	b = v115 - v123;
+	v114 += v122;
+	v115 += v123;
+	v122 = a * 0x1.1c73b39ae68c9p-1 + b * 0x1.a9b66290ea1a3p-1;
+	v123 = a * 0x1.a9b66290ea1a3p-1 - b * 0x1.1c73b39ae68c9p-1;
+	a = v116 - v124;
+	b = v117 - v125;
+	v116 += v124;
+	v117 += v125;
+	v124 = a * -0x1.8f8b83c69a608p-3 + b * 0x1.f6297cff75cbp-1;
+	v125 = a * 0x1.f6297cff75cbp-1 - b * -0x1.8f8b83c69a608p-3;
+	a = v118 - v126;
+	b = v119 - v127;
+	v118 += v126;
+	v119 += v127;
+	v126 = a * -0x1.a9b66290ea1a4p-1 + b * 0x1.1c73b39ae68c8p-1;
+	v127 = a * 0x1.1c73b39ae68c8p-1 - b * -0x1.a9b66290ea1a4p-1;
+	a = v0 - v4;
+	b = v1 - v5;
+	v0 += v4;
+	v1 += v5;
+	v4 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v5 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v2 - v6;
+	b = v3 - v7;
+	v2 += v6;
+	v3 += v7;
+	v6 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v7 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v0 - v2;
+	b = v1 - v3;
+	v0 += v2;
+	v1 += v3;
+	v2 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v3 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v4 - v6;
+	b = v5 - v7;
+	v4 += v6;
+	v5 += v7;
+	v6 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v7 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[0] = v0;
+	odd[254] = v1;
+	odd[126] = v2;
+	even[128] = v3;
+	odd[62] = v4;
+	even[192] = v5;
+	even[64] = v6;
+	odd[190] = v7;
+	a = v8 - v12;
+	b = v9 - v13;
+	v8 += v12;
+	v9 += v13;
+	v12 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v13 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v10 - v14;
+	b = v11 - v15;
+	v10 += v14;
+	v11 += v15;
+	v14 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v15 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v8 - v10;
+	b = v9 - v11;
+	v8 += v10;
+	v9 += v11;
+	v10 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v11 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v12 - v14;
+	b = v13 - v15;
+	v12 += v14;
+	v13 += v15;
+	v14 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v15 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[30] = v8;
+	even[224] = v9;
+	even[96] = v10;
+	odd[158] = v11;
+	even[32] = v12;
+	odd[222] = v13;
+	odd[94] = v14;
+	even[160] = v15;
+	a = v16 - v20;
+	b = v17 - v21;
+	v16 += v20;
+	v17 += v21;
+	v20 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v21 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v18 - v22;
+	b = v19 - v23;
+	v18 += v22;
+	v19 += v23;
+	v22 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v23 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v16 - v18;
+	b = v17 - v19;
+	v16 += v18;
+	v17 += v19;
+	v18 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v19 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v20 - v22;
+	b = v21 - v23;
+	v20 += v22;
+	v21 += v23;
+	v22 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v23 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[14] = v16;
+	even[240] = v17;
+	even[112] = v18;
+	odd[142] = v19;
+	even[48] = v20;
+	odd[206] = v21;
+	odd[78] = v22;
+	even[176] = v23;
+	a = v24 - v28;
+	b = v25 - v29;
+	v24 += v28;
+	v25 += v29;
+	v28 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v29 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v26 - v30;
+	b = v27 - v31;
+	v26 += v30;
+	v27 += v31;
+	v30 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v31 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v24 - v26;
+	b = v25 - v27;
+	v24 += v26;
+	v25 += v27;
+	v26 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v27 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v28 - v30;
+	b = v29 - v31;
+	v28 += v30;
+	v29 += v31;
+	v30 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v31 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[16] = v24;
+	odd[238] = v25;
+	odd[110] = v26;
+	even[144] = v27;
+	odd[46] = v28;
+	even[208] = v29;
+	even[80] = v30;
+	odd[174] = v31;
+	a = v32 - v36;
+	b = v33 - v37;
+	v32 += v36;
+	v33 += v37;
+	v36 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v37 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v34 - v38;
+	b = v35 - v39;
+	v34 += v38;
+	v35 += v39;
+	v38 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v39 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v32 - v34;
+	b = v33 - v35;
+	v32 += v34;
+	v33 += v35;
+	v34 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v35 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v36 - v38;
+	b = v37 - v39;
+	v36 += v38;
+	v37 += v39;
+	v38 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v39 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[6] = v32;
+	even[248] = v33;
+	even[120] = v34;
+	odd[134] = v35;
+	even[56] = v36;
+	odd[198] = v37;
+	odd[70] = v38;
+	even[184] = v39;
+	a = v40 - v44;
+	b = v41 - v45;
+	v40 += v44;
+	v41 += v45;
+	v44 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v45 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v42 - v46;
+	b = v43 - v47;
+	v42 += v46;
+	v43 += v47;
+	v46 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v47 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v40 - v42;
+	b = v41 - v43;
+	v40 += v42;
+	v41 += v43;
+	v42 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v43 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v44 - v46;
+	b = v45 - v47;
+	v44 += v46;
+	v45 += v47;
+	v46 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v47 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[24] = v40;
+	odd[230] = v41;
+	odd[102] = v42;
+	even[152] = v43;
+	odd[38] = v44;
+	even[216] = v45;
+	even[88] = v46;
+	odd[166] = v47;
+	a = v48 - v52;
+	b = v49 - v53;
+	v48 += v52;
+	v49 += v53;
+	v52 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v53 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v50 - v54;
+	b = v51 - v55;
+	v50 += v54;
+	v51 += v55;
+	v54 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v55 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v48 - v50;
+	b = v49 - v51;
+	v48 += v50;
+	v49 += v51;
+	v50 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v51 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v52 - v54;
+	b = v53 - v55;
+	v52 += v54;
+	v53 += v55;
+	v54 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v55 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[8] = v48;
+	odd[246] = v49;
+	odd[118] = v50;
+	even[136] = v51;
+	odd[54] = v52;
+	even[200] = v53;
+	even[72] = v54;
+	odd[182] = v55;
+	a = v56 - v60;
+	b = v57 - v61;
+	v56 += v60;
+	v57 += v61;
+	v60 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v61 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v58 - v62;
+	b = v59 - v63;
+	v58 += v62;
+	v59 += v63;
+	v62 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v63 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v56 - v58;
+	b = v57 - v59;
+	v56 += v58;
+	v57 += v59;
+	v58 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v59 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v60 - v62;
+	b = v61 - v63;
+	v60 += v62;
+	v61 += v63;
+	v62 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v63 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[22] = v56;
+	even[232] = v57;
+	even[104] = v58;
+	odd[150] = v59;
+	even[40] = v60;
+	odd[214] = v61;
+	odd[86] = v62;
+	even[168] = v63;
+	a = v64 - v68;
+	b = v65 - v69;
+	v64 += v68;
+	v65 += v69;
+	v68 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v69 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v66 - v70;
+	b = v67 - v71;
+	v66 += v70;
+	v67 += v71;
+	v70 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v71 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v64 - v66;
+	b = v65 - v67;
+	v64 += v66;
+	v65 += v67;
+	v66 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v67 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v68 - v70;
+	b = v69 - v71;
+	v68 += v70;
+	v69 += v71;
+	v70 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v71 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[2] = v64;
+	even[252] = v65;
+	even[124] = v66;
+	odd[130] = v67;
+	even[60] = v68;
+	odd[194] = v69;
+	odd[66] = v70;
+	even[188] = v71;
+	a = v72 - v76;
+	b = v73 - v77;
+	v72 += v76;
+	v73 += v77;
+	v76 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v77 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v74 - v78;
+	b = v75 - v79;
+	v74 += v78;
+	v75 += v79;
+	v78 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v79 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v72 - v74;
+	b = v73 - v75;
+	v72 += v74;
+	v73 += v75;
+	v74 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v75 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v76 - v78;
+	b = v77 - v79;
+	v76 += v78;
+	v77 += v79;
+	v78 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v79 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[28] = v72;
+	odd[226] = v73;
+	odd[98] = v74;
+	even[156] = v75;
+	odd[34] = v76;
+	even[220] = v77;
+	even[92] = v78;
+	odd[162] = v79;
+	a = v80 - v84;
+	b = v81 - v85;
+	v80 += v84;
+	v81 += v85;
+	v84 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v85 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v82 - v86;
+	b = v83 - v87;
+	v82 += v86;
+	v83 += v87;
+	v86 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v87 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v80 - v82;
+	b = v81 - v83;
+	v80 += v82;
+	v81 += v83;
+	v82 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v83 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v84 - v86;
+	b = v85 - v87;
+	v84 += v86;
+	v85 += v87;
+	v86 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v87 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[12] = v80;
+	odd[242] = v81;
+	odd[114] = v82;
+	even[140] = v83;
+	odd[50] = v84;
+	even[204] = v85;
+	even[76] = v86;
+	odd[178] = v87;
+	a = v88 - v92;
+	b = v89 - v93;
+	v88 += v92;
+	v89 += v93;
+	v92 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v93 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v90 - v94;
+	b = v91 - v95;
+	v90 += v94;
+	v91 += v95;
+	v94 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v95 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v88 - v90;
+	b = v89 - v91;
+	v88 += v90;
+	v89 += v91;
+	v90 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v91 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v92 - v94;
+	b = v93 - v95;
+	v92 += v94;
+	v93 += v95;
+	v94 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v95 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[18] = v88;
+	even[236] = v89;
+	even[108] = v90;
+	odd[146] = v91;
+	even[44] = v92;
+	odd[210] = v93;
+	odd[82] = v94;
+	even[172] = v95;
+	a = v96 - v100;
+	b = v97 - v101;
+	v96 += v100;
+	v97 += v101;
+	v100 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v101 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v98 - v102;
+	b = v99 - v103;
+	v98 += v102;
+	v99 += v103;
+	v102 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v103 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v96 - v98;
+	b = v97 - v99;
+	v96 += v98;
+	v97 += v99;
+	v98 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v99 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v100 - v102;
+	b = v101 - v103;
+	v100 += v102;
+	v101 += v103;
+	v102 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v103 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[4] = v96;
+	odd[250] = v97;
+	odd[122] = v98;
+	even[132] = v99;
+	odd[58] = v100;
+	even[196] = v101;
+	even[68] = v102;
+	odd[186] = v103;
+	a = v104 - v108;
+	b = v105 - v109;
+	v104 += v108;
+	v105 += v109;
+	v108 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v109 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v106 - v110;
+	b = v107 - v111;
+	v106 += v110;
+	v107 += v111;
+	v110 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v111 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v104 - v106;
+	b = v105 - v107;
+	v104 += v106;
+	v105 += v107;
+	v106 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v107 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v108 - v110;
+	b = v109 - v111;
+	v108 += v110;
+	v109 += v111;
+	v110 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v111 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[26] = v104;
+	even[228] = v105;
+	even[100] = v106;
+	odd[154] = v107;
+	even[36] = v108;
+	odd[218] = v109;
+	odd[90] = v110;
+	even[164] = v111;
+	a = v112 - v116;
+	b = v113 - v117;
+	v112 += v116;
+	v113 += v117;
+	v116 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v117 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v114 - v118;
+	b = v115 - v119;
+	v114 += v118;
+	v115 += v119;
+	v118 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v119 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v112 - v114;
+	b = v113 - v115;
+	v112 += v114;
+	v113 += v115;
+	v114 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v115 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v116 - v118;
+	b = v117 - v119;
+	v116 += v118;
+	v117 += v119;
+	v118 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v119 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	odd[10] = v112;
+	even[244] = v113;
+	even[116] = v114;
+	odd[138] = v115;
+	even[52] = v116;
+	odd[202] = v117;
+	odd[74] = v118;
+	even[180] = v119;
+	a = v120 - v124;
+	b = v121 - v125;
+	v120 += v124;
+	v121 += v125;
+	v124 = a * 0x1.d906bcf328d46p-1 + b * 0x1.87de2a6aea963p-2;
+	v125 = a * 0x1.87de2a6aea963p-2 - b * 0x1.d906bcf328d46p-1;
+	a = v122 - v126;
+	b = v123 - v127;
+	v122 += v126;
+	v123 += v127;
+	v126 = a * -0x1.87de2a6aea962p-2 + b * 0x1.d906bcf328d46p-1;
+	v127 = a * 0x1.d906bcf328d46p-1 - b * -0x1.87de2a6aea962p-2;
+	a = v120 - v122;
+	b = v121 - v123;
+	v120 += v122;
+	v121 += v123;
+	v122 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v123 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	a = v124 - v126;
+	b = v125 - v127;
+	v124 += v126;
+	v125 += v127;
+	v126 = a * 0x1.6a09e667f3bcdp-1 + b * 0x1.6a09e667f3bccp-1;
+	v127 = a * 0x1.6a09e667f3bccp-1 - b * 0x1.6a09e667f3bcdp-1;
+	even[20] = v120;
+	odd[234] = v121;
+	odd[106] = v122;
+	even[148] = v123;
+	odd[42] = v124;
+	even[212] = v125;
+	even[84] = v126;
+	odd[170] = v127;
+}
@@ -1,11 +1,14 @@
 #include "decinit.h"
 #include "bit_allocation.h"
 #include "bit_reader.h"
+#include "dispatch.h"
 #include "error_codes.h"
 #include "huffCodes.h"
+#include "mdct_tables.h"
 #include "structures.h"
 #include "tables.h"
 #include "utility.h"
+#include <limits.h>
 #include <math.h>
 #include <string.h>
 
@@ -14,40 +17,239 @@ static At9Status ReadConfigData(ConfigData* config);
 static At9Status InitFrame(Atrac9Handle* handle);
 static At9Status InitBlock(Block* block, Frame* parentFrame, int blockIndex);
 static At9Status InitChannel(Channel* channel, Block* parentBlock, int channelIndex);
+static int HasEnabledChannel(int channelCount, int channelMask, const double** gains, int downmixCount);
+static int ChannelUsed(const double** gains, int downmixCount, int channel);
+static void UpdateOutputChannels(Atrac9Handle* handle);
 static void InitHuffmanCodebooks();
 static void InitHuffmanSet(const HuffmanCodebook* codebooks, int count);
-static void GenerateTrigTables(int sizeBits);
-static void GenerateShuffleTable(int sizeBits);
-static void InitMdctTables();
-static void GenerateMdctWindow(Atrac9Handle* handle, int frameSizePower);
-static void GenerateImdctWindow(Atrac9Handle* handle, int frameSizePower);
+static void GenerateFixedPointTables();
+static int ToFixed(double value, int fractionBits);
 
 static int BlockTypeToChannelCount(BlockType blockType);
 
 void InitTables()
 {
 	InitMdctTables();
+	GenerateFixedPointTables();
 	InitHuffmanCodebooks();
 	GenerateGradientCurves();
+	InitDispatch();
 }
 
 At9Status InitDecoder(Atrac9Handle* handle, unsigned char* configData, int wlength)
 {
 	ERROR_CHECK(InitConfigData(&handle->Config, configData));
 	ERROR_CHECK(InitFrame(handle));
-	
-    //InitMdctTables(handle->Config.FrameSamplesPower);
-
-	GenerateMdctWindow(handle, handle->Config.FrameSamplesPower);
-	GenerateImdctWindow(handle, handle->Config.FrameSamplesPower);
 
 	//InitHuffmanCodebooks();
 	//GenerateGradientCurves();
 	handle->Wlength = wlength;
 	handle->Initialized = 1;
+	handle->DownmixChannelCount = 0;
+	handle->FixedPoint = FALSE;
+	memset(&handle->Profile, 0, sizeof(handle->Profile));
+	memset(&handle->Stats, 0, sizeof(handle->Stats));
+	return SetChannelMask(handle, (1 << handle->Config.ChannelCount) - 1);
+}
+
+At9Status SetChannelMask(Atrac9Handle* handle, int channelMask)
+{
+	const int allChannels = (1 << handle->Config.ChannelCount) - 1;
+
+	if (channelMask == 0 || (channelMask & ~allChannels) != 0)
+	{
+		return ERR_OPTION_CHANNEL_MASK_INVALID;
+	}
+
+	const double* gains[MAX_DOWNMIX_CHANNELS];
+	for (int i = 0; i < handle->DownmixChannelCount; i++)
+	{
+		gains[i] = handle->Downmix[i].Gains;
+	}
+
+	if (!HasEnabledChannel(handle->Config.ChannelCount, channelMask, gains, handle->DownmixChannelCount))
+	{
+		return ERR_OPTION_DOWNMIX_INVALID;
+	}
+
+	handle->ChannelMask = channelMask;
+	UpdateOutputChannels(handle);
+	return ERR_SUCCESS;
+}
+
+// Everything is checked before the handle is changed, so a failed call leaves it as it was
+At9Status SetDownmix(Atrac9Handle* handle, int outputChannelCount, const float* matrix)
+{
+	const int channelCount = handle->Config.ChannelCount;
+	double gainRows[MAX_DOWNMIX_CHANNELS][MAX_CHANNEL_COUNT];
+	const double* gains[MAX_DOWNMIX_CHANNELS];
+
+	if (outputChannelCount < 0 || outputChannelCount > MAX_DOWNMIX_CHANNELS)
+	{
+		return ERR_OPTION_DOWNMIX_INVALID;
+	}
+
+	if (outputChannelCount > 0 && matrix == NULL)
+	{
+		return ERR_OPTION_DOWNMIX_INVALID;
+	}
+
+	if (outputChannelCount > 0 && handle->FixedPoint)
+	{
+		return ERR_OPTION_FIXED_POINT_CONFLICT;
+	}
+
+	for (int i = 0; i < outputChannelCount; i++)
+	{
+		for (int c = 0; c < channelCount; c++)
+		{
+			gainRows[i][c] = matrix[i * channelCount + c];
+		}
+		gains[i] = gainRows[i];
+	}
+
+	if (!HasEnabledChannel(channelCount, handle->ChannelMask, gains, outputChannelCount))
+	{
+		return ERR_OPTION_DOWNMIX_INVALID;
+	}
+
+	// Channel overlap buffers aren't updated while downmixing
+	if (handle->DownmixChannelCount > 0 && outputChannelCount == 0)
+	{
+		for (int i = 0; i < channelCount; i++)
+		{
+			memset(handle->Frame.Channels[i]->Mdct.ImdctPrevious, 0, sizeof(handle->Frame.Channels[i]->Mdct.ImdctPrevious));
+		}
+	}
+
+	for (int i = 0; i < outputChannelCount; i++)
+	{
+		DownmixChannel* downmix = &handle->Downmix[i];
+		memset(downmix, 0, sizeof(DownmixChannel));
+		downmix->Mdct.Bits = handle->Config.FrameSamplesPower;
+		memcpy(downmix->Gains, gainRows[i], channelCount * sizeof(double));
+	}
+
+	handle->DownmixChannelCount = outputChannelCount;
+	UpdateOutputChannels(handle);
+	return ERR_SUCCESS;
+}
+
+// The overlap is carried over to the new format, so this can be switched mid-stream
+At9Status SetFixedPoint(Atrac9Handle* handle, int enabled)
+{
+	enabled = enabled != 0;
+
+	if (enabled && handle->DownmixChannelCount > 0)
+	{
+		return ERR_OPTION_FIXED_POINT_CONFLICT;
+	}
+
+	if (enabled == handle->FixedPoint) return ERR_SUCCESS;
+
+	for (int i = 0; i < handle->Config.ChannelCount; i++)
+	{
+		Channel* channel = handle->Frame.Channels[i];
+		Mdct* mdct = &channel->Mdct;
+
+		// Only the active format's spectrum is kept clear above SpectraEnd
+		memset(channel->Spectra, 0, sizeof(channel->Spectra));
+		memset(channel->FixedSpectra, 0, sizeof(channel->FixedSpectra));
+		channel->SpectraEnd = 0;
+
+		for (int k = 0; k < MAX_FRAME_SAMPLES; k++)
+		{
+			if (enabled)
+			{
+				mdct->FixedImdctPrevious[k] = ToFixed(mdct->ImdctPrevious[k], FIXED_SAMPLE_BITS);
+			}
+			else
+			{
+				mdct->ImdctPrevious[k] = ldexp(mdct->FixedImdctPrevious[k], -FIXED_SAMPLE_BITS);
+			}
+		}
+	}
+
+	handle->FixedPoint = enabled;
 	return ERR_SUCCESS;
 }
 
+// gains holds one row of channel gains per downmix output
+static int HasEnabledChannel(int channelCount, int channelMask, const double** gains, int downmixCount)
+{
+	for (int i = 0; i < channelCount; i++)
+	{
+		if (((channelMask >> i) & 1) && ChannelUsed(gains, downmixCount, i)) return TRUE;
+	}
+	return FALSE;
+}
+
+static int ChannelUsed(const double** gains, int downmixCount, int channel)
+{
+	if (downmixCount == 0) return TRUE;
+
+	for (int d = 0; d < downmixCount; d++)
+	{
+		if (gains[d][channel] != 0) return TRUE;
+	}
+	return FALSE;
+}
+
+// The caller has checked that at least one channel ends up enabled
+static void UpdateOutputChannels(Atrac9Handle* handle)
+{
+	const int channelCount = handle->Config.ChannelCount;
+	const int downmixCount = handle->DownmixChannelCount;
+	const double* gains[MAX_DOWNMIX_CHANNELS];
+
+	for (int d = 0; d < downmixCount; d++)
+	{
+		gains[d] = handle->Downmix[d].Gains;
+	}
+
+	for (int i = 0; i < channelCount; i++)
+	{
+		Channel* channel = handle->Frame.Channels[i];
+		const int enabled = ((handle->ChannelMask >> i) & 1) && ChannelUsed(gains, downmixCount, i);
+
+		// A channel that was skipped has a stale overlap buffer
+		if (enabled && !channel->Enabled)
+		{
+			memset(channel->Mdct.ImdctPrevious, 0, sizeof(channel->Mdct.ImdctPrevious));
+			memset(channel->Mdct.FixedImdctPrevious, 0, sizeof(channel->Mdct.FixedImdctPrevious));
+		}
+
+		channel->Enabled = enabled;
+	}
+
+	handle->OutputChannelCount = 0;
+
+	if (downmixCount > 0)
+	{
+		for (int i = 0; i < downmixCount; i++)
+		{
+			handle->OutputMdct[handle->OutputChannelCount] = &handle->Downmix[i].Mdct;
+			handle->OutputSpectra[handle->OutputChannelCount] = handle->Downmix[i].Spectra;
+			handle->OutputSpectraEnd[handle->OutputChannelCount] = &handle->Downmix[i].SpectraEnd;
+			handle->OutputPcm[handle->OutputChannelCount++] = handle->Downmix[i].Pcm;
+		}
+	}
+	else
+	{
+		for (int i = 0; i < channelCount; i++)
+		{
+			if (handle->Frame.Channels[i]->Enabled)
+			{
+				handle->OutputMdct[handle->OutputChannelCount] = &handle->Frame.Channels[i]->Mdct;
+				handle->OutputSpectra[handle->OutputChannelCount] = handle->Frame.Channels[i]->Spectra;
+				handle->OutputSpectraEnd[handle->OutputChannelCount] = &handle->Frame.Channels[i]->SpectraEnd;
+				handle->OutputFixedPcm[handle->OutputChannelCount] = handle->Frame.Channels[i]->FixedPcm;
+				handle->OutputPcm[handle->OutputChannelCount++] = handle->Frame.Channels[i]->Pcm;
+			}
+		}
+	}
+}
+
 static At9Status InitConfigData(ConfigData* config, unsigned char* configData)
 {
 	memcpy(config->ConfigData, configData, CONFIG_DATA_SIZE);
@@ -113,6 +315,7 @@ static At9Status InitBlock(Block* block, Frame* parentFrame, int blockIndex)
 	block->Config = parentFrame->Config;
 	block->BlockType = block->Config->ChannelConfig.Types[blockIndex];
 	block->ChannelCount = BlockTypeToChannelCount(block->BlockType);
+	block->GradientKey.Valid = FALSE;
 
 	for (int i = 0; i < block->ChannelCount; i++)
 	{
@@ -129,6 +332,7 @@ static At9Status InitChannel(Channel* channel, Block* parentBlock, int channelIn
 	channel->Config = parentBlock->Config;
 	channel->ChannelIndex = channelIndex;
 	channel->Mdct.Bits = parentBlock->Config->FrameSamplesPower;
+	channel->AllocationKey.Valid = FALSE;
 	return ERR_SUCCESS;
 }
 
@@ -137,74 +341,59 @@ static void InitHuffmanCodebooks()
 	InitHuffmanSet(HuffmanScaleFactorsUnsigned, sizeof(HuffmanScaleFactorsUnsigned) / sizeof(HuffmanCodebook));
 	InitHuffmanSet(HuffmanScaleFactorsSigned, sizeof(HuffmanScaleFactorsSigned) / sizeof(HuffmanCodebook));
 	InitHuffmanSet((HuffmanCodebook*)HuffmanSpectrum, sizeof(HuffmanSpectrum) / sizeof(HuffmanCodebook));
-}
 
-static void InitHuffmanSet(const HuffmanCodebook* codebooks, int count)
-{
-	for (int i = 0; i < count; i++)
+	for (int i = 1; i < 7; i++)
 	{
-		InitHuffmanCodebook(&codebooks[i]);
+		InitHuffmanMultiLookup(&HuffmanScaleFactorsUnsigned[i], HuffmanScaleFactorsUnsignedMulti[i]);
 	}
-}
 
-static void InitMdctTables()
-{
-	for (int i = 0; i < 9; i++)
+	for (int i = 2; i < 6; i++)
 	{
-		GenerateTrigTables(i);
-		GenerateShuffleTable(i);
+		InitHuffmanMultiLookup(&HuffmanScaleFactorsSigned[i], HuffmanScaleFactorsSignedMulti[i]);
 	}
-
-	//GenerateMdctWindow(frameSizePower);
-	//GenerateImdctWindow(frameSizePower);
 }
 
-static void GenerateTrigTables(int sizeBits)
+static void InitHuffmanSet(const HuffmanCodebook* codebooks, int count)
 {
-	const int size = 1 << sizeBits;
-	double* sinTab = SinTables[sizeBits];
-	double* cosTab = CosTables[sizeBits];
-
-	for (int i = 0; i < size; i++)
+	for (int i = 0; i < count; i++)
 	{
-		const double value = M_PI * (4 * i + 1) / (4 * size);
-		sinTab[i] = sin(value);
-		cosTab[i] = cos(value);
+		InitHuffmanCodebook(&codebooks[i]);
 	}
 }
 
-static void GenerateShuffleTable(int sizeBits)
+// Built from the double tables so both paths share the same constants
+static void GenerateFixedPointTables()
 {
-	const int size = 1 << sizeBits;
-	int* table = ShuffleTables[sizeBits];
-
-	for (int i = 0; i < size; i++)
+	for (int i = 0; i < 16; i++)
 	{
-		table[i] = BitReverse32(i ^ (i / 2), sizeBits);
+		FixedQuantizerStepSize[i] = llround(ldexp(QuantizerStepSize[i], FIXED_STEP_BITS));
+		FixedQuantizerFineStepSize[i] = llround(ldexp(QuantizerFineStepSize[i], FIXED_STEP_BITS));
 	}
-}
 
-static void GenerateMdctWindow(Atrac9Handle* handle, int frameSizePower)
-{
-	const int frameSize = 1 << frameSizePower;
-	double* mdct = handle->MdctWindow[frameSizePower - 6];
+	for (int i = 0; i < 9; i++)
+	{
+		for (int k = 0; k < 256; k++)
+		{
+			FixedSinTables[i][k] = ToFixed(SinTables[i][k], FIXED_TRIG_BITS);
+			FixedCosTables[i][k] = ToFixed(CosTables[i][k], FIXED_TRIG_BITS);
+		}
+	}
 
-	for (int i = 0; i < frameSize; i++)
+	for (int i = 0; i < 3; i++)
 	{
-		mdct[i] = (sin(((i + 0.5) / frameSize - 0.5) * M_PI) + 1.0) * 0.5;
+		for (int k = 0; k < 256; k++)
+		{
+			FixedImdctWindow[i][k] = ToFixed(ImdctWindow[i][k], FIXED_WINDOW_BITS);
+		}
 	}
 }
 
-static void GenerateImdctWindow(Atrac9Handle* handle, int frameSizePower)
+static int ToFixed(double value, int fractionBits)
 {
-	const int frameSize = 1 << frameSizePower;
-	double* imdct = handle->ImdctWindow[frameSizePower - 6];
-	double* mdct = handle->MdctWindow[frameSizePower - 6];
-
-	for (int i = 0; i < frameSize; i++)
-	{
-		imdct[i] = mdct[i] / (mdct[frameSize - 1 - i] * mdct[frameSize - 1 - i] + mdct[i] * mdct[i]);
-	}
+	const double scaled = ldexp(value, fractionBits);
+	if (scaled >= INT_MAX) return INT_MAX;
+	if (scaled <= INT_MIN) return INT_MIN;
+	return (int)llround(scaled);
 }
 
 static int BlockTypeToChannelCount(BlockType blockType)
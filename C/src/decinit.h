@@ -5,3 +5,6 @@
 
 void InitTables();
 At9Status InitDecoder(Atrac9Handle* handle, unsigned char * configData, int wlength);
+At9Status SetChannelMask(Atrac9Handle* handle, int channelMask);
+At9Status SetDownmix(Atrac9Handle* handle, int outputChannelCount, const float* matrix);
+At9Status SetFixedPoint(Atrac9Handle* handle, int enabled);
@@ -1,104 +1,507 @@
 #include "decoder.h"
 #include "band_extension.h"
 #include "bit_reader.h"
+#include "dispatch.h"
 #include "imdct.h"
+#include "profile.h"
 #include "quantization.h"
 #include "tables.h"
 #include "unpack.h"
 #include "utility.h"
 #include <string.h>
 
-static At9Status DecodeFrame(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br);
-static void ImdctBlock(Atrac9Handle* handle, Block* block);
-static void ApplyIntensityStereo(Block* block);
-static void PcmFloatToShort(Frame* frame, short* pcmOut);
+static At9Status DecodeFrame(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br, ImdctBatch* imdct);
+static At9Status UnpackFrameProfiled(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br);
+static void SynthesizeFrame(Atrac9Handle* handle, Frame* frame, ImdctBatch* imdct, int dequantized);
+static int ListDequantizedChannels(Frame* frame, Channel** channels);
+static void DequantizeBatchGroup(Atrac9Handle** handles, int handleCount, Channel** channels, int channelCount);
+static void SynthesizeChannel(Channel* channel, ImdctBatch* imdct, int dequantized, ProfileStats* profile);
+static void SynthesizeChannelFixed(Channel* channel, ProfileStats* profile);
+static void WritePcm(Atrac9Handle* handle, short* pcmOut);
+static void FixedPcmToShort(int** channels, int channelCount, int sampleCount, short* pcmOut);
+static void SilenceBlock(Block* block, int runImdct, int fixedPoint);
+static void DownmixSpectra(Atrac9Handle* handle, Frame* frame);
+static void ImdctDownmix(Atrac9Handle* handle, ImdctBatch* imdct);
+static void RunImdctBatchProfiled(ImdctBatch* imdct, ProfileStats* profile);
+static int BlockEnabled(Block* block);
 
 At9Status Decode(Atrac9Handle* handle, const unsigned char* audio, unsigned char* pcm, int* bytesUsed)
 {
 	BitReaderCxt br;
+	ImdctBatch imdct;
+	imdct.Count = 0;
 	InitBitReaderCxt(&br, audio);
-	ERROR_CHECK(DecodeFrame(handle, &handle->Frame, &br));
+	ERROR_CHECK(DecodeFrame(handle, &handle->Frame, &br, &imdct));
 
-	PcmFloatToShort(&handle->Frame, (short*)pcm);
+	// All channels of a frame are transformed together
+	RunImdctBatchProfiled(&imdct, &handle->Profile);
+	WritePcm(handle, (short*)pcm);
 
 	*bytesUsed = br.Position / 8;
 	return ERR_SUCCESS;
 }
 
-static At9Status DecodeFrame(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br)
+// Unpacks every frame of a superframe before running any transforms, so
+// the frames' IMDCTs share one batch. The overlap-add still runs frame by
+// frame, as each frame overlaps the one before it. Superframes with too
+// many transforms for one batch, or decoded in fixed point, are decoded a
+// frame at a time. Either way, on failure the frames before the failing
+// one are output and counted in bytesUsed, and the rest of pcm is left
+// as it was. The superframe is reported silent only if all of its output
+// frames were.
+At9Status DecodeSuperframe(Atrac9Handle* handle, const unsigned char* audio, unsigned char* pcm, int* bytesUsed)
 {
+	const int frameCount = handle->Config.FramesPerSuperframe;
+	const int channelCount = handle->OutputChannelCount;
+	const int frameSamples = handle->Config.FrameSamples;
+	short* pcmOut = (short*)pcm;
+	At9Status status = ERR_SUCCESS;
+	BitReaderCxt br;
+	ImdctBatch imdct;
+	imdct.Count = 0;
+	int decoded;
+	int silent = TRUE;
+
+	InitBitReaderCxt(&br, audio);
+	*bytesUsed = 0;
+
+	if (handle->FixedPoint || frameCount * channelCount > IMDCT_BATCH_SIZE)
+	{
+		for (decoded = 0; decoded < frameCount; decoded++)
+		{
+			status = DecodeFrame(handle, &handle->Frame, &br, &imdct);
+			if (status != ERR_SUCCESS) break;
+
+			silent &= handle->Frame.Silent;
+			RunImdctBatchProfiled(&imdct, &handle->Profile);
+			WritePcm(handle, pcmOut + decoded * frameSamples * channelCount);
+			*bytesUsed = br.Position / 8;
+		}
+
+		handle->Frame.Silent = decoded > 0 && silent;
+		return status;
+	}
+
+	for (decoded = 0; decoded < frameCount; decoded++)
+	{
+		status = DecodeFrame(handle, &handle->Frame, &br, NULL);
+		if (status != ERR_SUCCESS) break;
+
+		silent &= handle->Frame.Silent;
+		PROFILE_START(queueStart);
+		for (int ch = 0; ch < channelCount; ch++)
+		{
+			AddToImdctBatch(&imdct, handle->OutputMdct[ch], handle->OutputSpectra[ch], *handle->OutputSpectraEnd[ch], NULL);
+		}
+		PROFILE_ACCUMULATE(&handle->Profile, ProfileImdct, queueStart);
+		*bytesUsed = br.Position / 8;
+	}
+
+	PROFILE_START(transformStart);
+	TransformImdctBatch(&imdct);
+	PROFILE_ACCUMULATE(&handle->Profile, ProfileImdct, transformStart);
+
+	for (int i = 0; i < decoded; i++)
+	{
+		PROFILE_START(overlapStart);
+		for (int ch = 0; ch < channelCount; ch++)
+		{
+			OverlapImdctBatchLane(&imdct, i * channelCount + ch, handle->OutputPcm[ch]);
+		}
+		PROFILE_STOP(&handle->Profile, ProfileImdct, overlapStart);
+
+		PROFILE_START(pcmStart);
+		Kernels.PcmFloatToShort(handle->OutputPcm, channelCount, frameSamples, pcmOut + i * frameSamples * channelCount);
+		PROFILE_STOP(&handle->Profile, ProfilePcmToShort, pcmStart);
+	}
+
+	handle->Frame.Silent = decoded > 0 && silent;
+	return status;
+}
+
+At9Status DecodeSpectra(Atrac9Handle* handle, const unsigned char* audio, int* bytesUsed)
+{
+	BitReaderCxt br;
+
+	// Only Decode, DecodeSuperframe and DecodeBatch synthesize in fixed point
+	if (handle->FixedPoint) return ERR_OPTION_FIXED_POINT_CONFLICT;
+
+	InitBitReaderCxt(&br, audio);
+	ERROR_CHECK(DecodeFrame(handle, &handle->Frame, &br, NULL));
+
+	*bytesUsed = br.Position / 8;
+	return ERR_SUCCESS;
+}
+
+// Runs the IMDCT straight into the caller's mix buffer, skipping the
+// intermediate PCM and 16-bit conversion passes.
+At9Status DecodeMix(Atrac9Handle* handle, const unsigned char* audio, float* mix, const float* gains, int* bytesUsed)
+{
+	const int channelCount = handle->OutputChannelCount;
+	ERROR_CHECK(DecodeSpectra(handle, audio, bytesUsed));
+
+	PROFILE_START(imdctStart);
+	for (int ch = 0; ch < channelCount; ch++)
+	{
+		RunImdctMix(handle->OutputMdct[ch], handle->OutputSpectra[ch], *handle->OutputSpectraEnd[ch], mix + ch, channelCount, gains[ch]);
+	}
+	PROFILE_STOP(&handle->Profile, ProfileImdct, imdctStart);
+
+	return ERR_SUCCESS;
+}
+
+// Streams are unpacked one at a time, but their IMDCTs are queued into a
+// shared batch so the transforms run across all of the streams at once.
+// Float streams are taken in groups of up to IMDCT_BATCH_SIZE channels,
+// whose coded units are dequantized together before any of the group is
+// synthesized. On failure, the streams before the failing one are still
+// fully decoded. The shared passes' cost is split evenly between the
+// streams' profiles.
+At9Status DecodeBatch(Atrac9Handle** handles, int handleCount, const unsigned char** audio, short** pcm, int* bytesUsed)
+{
+	At9Status status = ERR_SUCCESS;
+	ImdctBatch imdct;
+	imdct.Count = 0;
+	int decoded = 0;
+
+	// A handle's second frame would be unpacked over its first before the
+	// queued transforms read its spectra
+	for (int i = 1; i < handleCount; i++)
+	{
+		for (int j = 0; j < i; j++)
+		{
+			if (handles[i] == handles[j]) return ERR_BATCH_HANDLE_DUPLICATE;
+		}
+	}
+
+	while (decoded < handleCount && status == ERR_SUCCESS)
+	{
+		Channel* channels[IMDCT_BATCH_SIZE];
+		int channelCount = 0;
+		const int groupStart = decoded;
+
+		for (; decoded < handleCount; decoded++)
+		{
+			// MAX_CHANNEL_COUNT fits a group, so each group takes a handle
+			Atrac9Handle* handle = handles[decoded];
+			if (channelCount + handle->Config.ChannelCount > IMDCT_BATCH_SIZE) break;
+
+			BitReaderCxt br;
+			InitBitReaderCxt(&br, audio[decoded]);
+			status = UnpackFrameProfiled(handle, &handle->Frame, &br);
+			if (status != ERR_SUCCESS) break;
+
+			bytesUsed[decoded] = br.Position / 8;
+			if (!handle->FixedPoint)
+			{
+				channelCount += ListDequantizedChannels(&handle->Frame, channels + channelCount);
+			}
+		}
+
+		DequantizeBatchGroup(handles + groupStart, decoded - groupStart, channels, channelCount);
+
+		for (int i = groupStart; i < decoded; i++)
+		{
+			SynthesizeFrame(handles[i], &handles[i]->Frame, &imdct, !handles[i]->FixedPoint);
+		}
+	}
+
+	PROFILE_START(imdctStart);
+	RunImdctBatch(&imdct);
+#ifdef ATRAC9_PROFILE
+	const uint64_t imdctTicks = ProfileTicks() - imdctStart;
+	for (int i = 0; i < decoded; i++)
+	{
+		AddProfileSample(&handles[i]->Profile, ProfileImdct, imdctTicks / decoded);
+	}
+#endif
+
+	for (int i = 0; i < decoded; i++)
+	{
+		WritePcm(handles[i], pcm[i]);
+	}
+
+	return status;
+}
+
+// If imdct is given, the frame's transforms are added to it and the
+// caller must run the batch before using the output PCM
+static At9Status DecodeFrame(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br, ImdctBatch* imdct)
+{
+	ERROR_CHECK(UnpackFrameProfiled(handle, frame, br));
+	SynthesizeFrame(handle, frame, imdct, FALSE);
+	return ERR_SUCCESS;
+}
+
+static At9Status UnpackFrameProfiled(Atrac9Handle* handle, Frame* frame, BitReaderCxt* br)
+{
+	PROFILE_START(unpackStart);
 	ERROR_CHECK(UnpackFrame(frame, br));
+	PROFILE_STOP(&handle->Profile, ProfileUnpackFrame, unpackStart);
+	RecordStreamStats(frame, &handle->Stats);
+	return ERR_SUCCESS;
+}
+
+// With dequantized set, the float channels' spectra were already
+// dequantized by DequantizeBatchGroup
+static void SynthesizeFrame(Atrac9Handle* handle, Frame* frame, ImdctBatch* imdct, int dequantized)
+{
+	// These two stages are timed per channel below
+	PROFILE_COUNT(&handle->Profile, ProfileDequantizeSpectra);
+	PROFILE_COUNT(&handle->Profile, ProfileBandExtension);
+	frame->Silent = TRUE;
 
 	for (int i = 0; i < frame->Config->ChannelConfig.BlockCount; i++)
 	{
 		Block* block = &frame->Blocks[i];
 
-		DequantizeSpectra(block);
-		ApplyIntensityStereo(block);
-		ScaleSpectrumBlock(block);
-		ApplyBandExtension(block);
-		ImdctBlock(handle, block);
+		// The block still had to be unpacked to find the start of the next one
+		if (!BlockEnabled(block)) continue;
+
+		if (block->Silent)
+		{
+			SilenceBlock(block, imdct && handle->DownmixChannelCount == 0, handle->FixedPoint);
+			continue;
+		}
+
+		frame->Silent = FALSE;
+
+		for (int c = 0; c < block->ChannelCount; c++)
+		{
+			Channel* channel = &block->Channels[c];
+			if (!channel->Enabled) continue;
+
+			if (handle->FixedPoint)
+			{
+				SynthesizeChannelFixed(channel, &handle->Profile);
+			}
+			else
+			{
+				SynthesizeChannel(channel, handle->DownmixChannelCount == 0 ? imdct : NULL, dequantized, &handle->Profile);
+			}
+		}
 	}
 
-	return ERR_SUCCESS;
+	if (handle->DownmixChannelCount > 0)
+	{
+		DownmixSpectra(handle, frame);
+
+		if (imdct)
+		{
+			ImdctDownmix(handle, imdct);
+		}
+	}
 }
 
-void PcmFloatToShort(Frame* frame, short* pcmOut)
+// Lists the channels SynthesizeFrame dequantizes and returns how many
+static int ListDequantizedChannels(Frame* frame, Channel** channels)
 {
-	const int channelCount = frame->Config->ChannelCount;
-	const int sampleCount = frame->Config->FrameSamples;
-	Channel** channels = frame->Channels;
-	int i = 0;
+	int count = 0;
 
-	for (int smpl = 0; smpl < sampleCount; smpl++)
+	for (int i = 0; i < frame->Config->ChannelConfig.BlockCount; i++)
 	{
-		for (int ch = 0; ch < channelCount; ch++, i++)
+		Block* block = &frame->Blocks[i];
+		if (block->Silent) continue;
+
+		for (int c = 0; c < block->ChannelCount; c++)
 		{
-			pcmOut[i] = Clamp16(Round(channels[ch]->Pcm[smpl]));
+			if (block->Channels[c].Enabled)
+			{
+				channels[count++] = &block->Channels[c];
+			}
 		}
 	}
+
+	return count;
 }
 
-static void ImdctBlock(Atrac9Handle* handle, Block* block)
+static void DequantizeBatchGroup(Atrac9Handle** handles, int handleCount, Channel** channels, int channelCount)
 {
-	for (int i = 0; i < block->ChannelCount; i++)
+	PROFILE_START(dequantizeStart);
+	DequantizeSpectraLockstep(channels, channelCount);
+#ifdef ATRAC9_PROFILE
+	const uint64_t dequantizeTicks = ProfileTicks() - dequantizeStart;
+	for (int i = 0; i < handleCount; i++)
 	{
-		Channel* channel = &block->Channels[i];
+		handles[i]->Profile.Stages[ProfileDequantizeSpectra].Cycles += dequantizeTicks / handleCount;
+	}
+#else
+	(void)handles;
+	(void)handleCount;
+#endif
+}
 
-		RunImdct(handle, &channel->Mdct, channel->Spectra, channel->Pcm);
+// Runs each stage back to back on one channel so its spectrum stays in
+// cache, then queues the channel's IMDCT if a batch is given
+static void SynthesizeChannel(Channel* channel, ImdctBatch* imdct, int dequantized, ProfileStats* profile)
+{
+	if (!dequantized)
+	{
+		PROFILE_START(dequantizeStart);
+		DequantizeSpectra(channel);
+		PROFILE_ACCUMULATE(profile, ProfileDequantizeSpectra, dequantizeStart);
+	}
+
+	PROFILE_START(extensionStart);
+	ApplyBandExtension(channel);
+	PROFILE_ACCUMULATE(profile, ProfileBandExtension, extensionStart);
+
+	if (imdct)
+	{
+		PROFILE_START(imdctStart);
+		AddToImdctBatch(imdct, &channel->Mdct, channel->Spectra, channel->SpectraEnd, channel->Pcm);
+		PROFILE_ACCUMULATE(profile, ProfileImdct, imdctStart);
 	}
 }
 
-static void ApplyIntensityStereo(Block* block)
+// Fixed-point synthesis is only enabled when decoding straight to PCM
+static void SynthesizeChannelFixed(Channel* channel, ProfileStats* profile)
 {
-	if (block->BlockType != Stereo) return;
+	PROFILE_START(dequantizeStart);
+	DequantizeSpectraFixed(channel);
+	PROFILE_ACCUMULATE(profile, ProfileDequantizeSpectra, dequantizeStart);
+
+	PROFILE_START(extensionStart);
+	ApplyBandExtensionFixed(channel);
+	PROFILE_ACCUMULATE(profile, ProfileBandExtension, extensionStart);
 
-	const int totalUnits = block->QuantizationUnitCount;
-	const int stereoUnits = block->StereoQuantizationUnit;
-	if (stereoUnits >= totalUnits) return;
+	PROFILE_START(imdctStart);
+	RunImdctFixed(&channel->Mdct, channel->FixedSpectra, channel->SpectraEnd, channel->FixedPcm);
+	PROFILE_ACCUMULATE(profile, ProfileImdct, imdctStart);
+}
+
+static void RunImdctBatchProfiled(ImdctBatch* imdct, ProfileStats* profile)
+{
+	PROFILE_START(imdctStart);
+	RunImdctBatch(imdct);
+	PROFILE_STOP(profile, ProfileImdct, imdctStart);
+}
 
-	Channel* source = &block->Channels[block->PrimaryChannelIndex == 0 ? 0 : 1];
-	Channel* dest = &block->Channels[block->PrimaryChannelIndex == 0 ? 1 : 0];
+static void WritePcm(Atrac9Handle* handle, short* pcmOut)
+{
+	PROFILE_START(pcmStart);
 
-	for (int i = stereoUnits; i < totalUnits; i++)
+	if (handle->FixedPoint)
+	{
+		FixedPcmToShort(handle->OutputFixedPcm, handle->OutputChannelCount, handle->Config.FrameSamples, pcmOut);
+	}
+	else
 	{
-		const int sign = block->JointStereoSigns[i];
-		for (int sb = QuantUnitToCoeffIndex[i]; sb < QuantUnitToCoeffIndex[i + 1]; sb++)
+		Kernels.PcmFloatToShort(handle->OutputPcm, handle->OutputChannelCount, handle->Config.FrameSamples, pcmOut);
+	}
+
+	PROFILE_STOP(&handle->Profile, ProfilePcmToShort, pcmStart);
+}
+
+// Rounds the same way as PcmFloatToShort
+static void FixedPcmToShort(int** channels, int channelCount, int sampleCount, short* pcmOut)
+{
+	int i = 0;
+
+	for (int smpl = 0; smpl < sampleCount; smpl++)
+	{
+		for (int ch = 0; ch < channelCount; ch++, i++)
 		{
-			if (sign > 0)
-			{
-				dest->Spectra[sb] = -source->Spectra[sb];
-			}
-			else
+			pcmOut[i] = Clamp16((int)RoundShift64(channels[ch][smpl], FIXED_SAMPLE_BITS));
+		}
+	}
+}
+
+// The IMDCT is linear, so mixing the spectra lets each output channel
+// be synthesized with a single transform.
+static void DownmixSpectra(Atrac9Handle* handle, Frame* frame)
+{
+	const int channelCount = frame->Config->ChannelCount;
+
+	for (int i = 0; i < handle->DownmixChannelCount; i++)
+	{
+		DownmixChannel* downmix = &handle->Downmix[i];
+		memset(downmix->Spectra, 0, sizeof(downmix->Spectra));
+		downmix->SpectraEnd = 0;
+
+		for (int ch = 0; ch < channelCount; ch++)
+		{
+			const Channel* channel = frame->Channels[ch];
+			const double gain = downmix->Gains[ch];
+			if (!channel->Enabled || gain == 0) continue;
+
+			for (int sb = 0; sb < channel->SpectraEnd; sb++)
 			{
-				dest->Spectra[sb] = source->Spectra[sb];
+				downmix->Spectra[sb] += channel->Spectra[sb] * gain;
 			}
+			downmix->SpectraEnd = Max(downmix->SpectraEnd, channel->SpectraEnd);
 		}
 	}
 }
 
+static void ImdctDownmix(Atrac9Handle* handle, ImdctBatch* imdct)
+{
+	for (int i = 0; i < handle->DownmixChannelCount; i++)
+	{
+		DownmixChannel* downmix = &handle->Downmix[i];
+		AddToImdctBatch(imdct, &downmix->Mdct, downmix->Spectra, downmix->SpectraEnd, downmix->Pcm);
+	}
+}
+
+static void SilenceBlock(Block* block, int runImdct, int fixedPoint)
+{
+	for (int i = 0; i < block->ChannelCount; i++)
+	{
+		Channel* channel = &block->Channels[i];
+		if (!channel->Enabled) continue;
+
+		if (fixedPoint)
+		{
+			memset(channel->FixedSpectra, 0, channel->SpectraEnd * sizeof(int));
+			channel->SpectraEnd = 0;
+			RunImdctSilentFixed(&channel->Mdct, channel->FixedPcm);
+		}
+		else if (runImdct)
+		{
+			RunImdctSilent(&channel->Mdct, channel->Pcm);
+		}
+		else
+		{
+			memset(channel->Spectra, 0, channel->SpectraEnd * sizeof(double));
+			channel->SpectraEnd = 0;
+		}
+	}
+}
+
+static int BlockEnabled(Block* block)
+{
+	for (int i = 0; i < block->ChannelCount; i++)
+	{
+		if (block->Channels[i].Enabled) return TRUE;
+	}
+	return FALSE;
+}
+
+int IsFrameSilent(Atrac9Handle* handle)
+{
+	return handle->Frame.Silent;
+}
+
 int GetCodecInfo(Atrac9Handle* handle, ConfigData* pCodecInfo)
 {
     *pCodecInfo = handle->Config;
 	return ERR_SUCCESS;
 }
+
+int GetStreamStats(Atrac9Handle* handle, StreamStats* stats)
+{
+	*stats = handle->Stats;
+	return ERR_SUCCESS;
+}
+
+At9Status GetProfile(Atrac9Handle* handle, ProfileStats* stats)
+{
+#ifdef ATRAC9_PROFILE
+	*stats = handle->Profile;
+	return ERR_SUCCESS;
+#else
+	(void)handle;
+	(void)stats;
+	return ERR_NOT_IMPLEMENTED;
+#endif
+}
@@ -4,4 +4,11 @@
 #include "structures.h"
 
 At9Status Decode(Atrac9Handle* handle, const unsigned char* audio, unsigned char* pcm, int* bytesUsed);
+At9Status DecodeSuperframe(Atrac9Handle* handle, const unsigned char* audio, unsigned char* pcm, int* bytesUsed);
+At9Status DecodeSpectra(Atrac9Handle* handle, const unsigned char* audio, int* bytesUsed);
+At9Status DecodeMix(Atrac9Handle* handle, const unsigned char* audio, float* mix, const float* gains, int* bytesUsed);
+At9Status DecodeBatch(Atrac9Handle** handles, int handleCount, const unsigned char** audio, short** pcm, int* bytesUsed);
+int IsFrameSilent(Atrac9Handle* handle);
 int GetCodecInfo(Atrac9Handle* handle, ConfigData* pCodecInfo);
+int GetStreamStats(Atrac9Handle* handle, StreamStats* stats);
+At9Status GetProfile(Atrac9Handle* handle, ProfileStats* stats);
@@ -0,0 +1,94 @@
+#include "dispatch.h"
+#include "kernels.h"
+#include "utility.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+static CpuLevel DetectCpuLevel();
+static CpuLevel OverrideCpuLevel(CpuLevel supported);
+
+KernelTable Kernels;
+
+// ATRAC9_CPU set to generic, sse41, avx2 or avx512 in the environment
+// picks a lower level than the CPU supports, for testing and benchmarking.
+void InitDispatch()
+{
+	const CpuLevel level = OverrideCpuLevel(DetectCpuLevel());
+
+	Kernels.Level = CpuLevelGeneric;
+	Kernels.Dct4 = Dct4Generic;
+	Kernels.TransformImdctBatch = TransformImdctBatchGeneric;
+	Kernels.OverlapImdctBatchLane = OverlapImdctBatchLaneGeneric;
+	Kernels.DequantizeQuantUnit = DequantizeQuantUnitGeneric;
+	Kernels.DequantizeQuantUnits = DequantizeQuantUnitsGeneric;
+	Kernels.ScaleSpectrum = ScaleSpectrumGeneric;
+	Kernels.MirrorSpectrum = MirrorSpectrumGeneric;
+	Kernels.PcmFloatToShort = PcmFloatToShortGeneric;
+
+	if (level >= CpuLevelSse41 && GetSse41Kernels(&Kernels))
+	{
+		Kernels.Level = CpuLevelSse41;
+	}
+
+	if (level >= CpuLevelAvx2 && GetAvx2Kernels(&Kernels))
+	{
+		Kernels.Level = CpuLevelAvx2;
+	}
+
+	if (level >= CpuLevelAvx512 && GetAvx512Kernels(&Kernels))
+	{
+		Kernels.Level = CpuLevelAvx512;
+	}
+}
+
+static CpuLevel DetectCpuLevel()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int info[4];
+	__cpuid(info, 0);
+	const int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	const int sse41 = (info[2] >> 19) & 1;
+	const int osxsave = (info[2] >> 27) & 1;
+	const int avx = (info[2] >> 28) & 1;
+	if (!sse41) return CpuLevelGeneric;
+
+	// AVX2 also needs the OS to save the YMM registers
+	if (maxLeaf < 7 || !osxsave || !avx || (_xgetbv(0) & 6) != 6) return CpuLevelSse41;
+
+	__cpuidex(info, 7, 0);
+	if (!((info[1] >> 5) & 1)) return CpuLevelSse41;
+
+	// and AVX-512 the opmask and ZMM registers
+	const int avx512 = (info[1] >> 16) & 1;
+	return avx512 && (_xgetbv(0) & 0xE6) == 0xE6 ? CpuLevelAvx512 : CpuLevelAvx2;
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) return CpuLevelAvx512;
+	if (__builtin_cpu_supports("avx2")) return CpuLevelAvx2;
+	if (__builtin_cpu_supports("sse4.1")) return CpuLevelSse41;
+	return CpuLevelGeneric;
+#else
+	return CpuLevelGeneric;
+#endif
+}
+
+static CpuLevel OverrideCpuLevel(CpuLevel supported)
+{
+	const char* name = getenv("ATRAC9_CPU");
+	CpuLevel requested = supported;
+	if (name == NULL) return supported;
+
+	if (strcmp(name, "generic") == 0) requested = CpuLevelGeneric;
+	else if (strcmp(name, "sse41") == 0) requested = CpuLevelSse41;
+	else if (strcmp(name, "avx2") == 0) requested = CpuLevelAvx2;
+	else if (strcmp(name, "avx512") == 0) requested = CpuLevelAvx512;
+
+	return Min(requested, supported);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "structures.h"
+
+typedef enum {
+	CpuLevelGeneric,
+	CpuLevelSse41,
+	CpuLevelAvx2,
+	CpuLevelAvx512
+} CpuLevel;
+
+// The hot kernels, picked once for the running CPU by InitDispatch.
+// Every variant gives bit-identical output.
+typedef struct {
+	CpuLevel Level;
+	void(*Dct4)(Mdct* mdct, double* input, int inputBins, double* output);
+	void(*TransformImdctBatch)(ImdctBatch* batch);
+	void(*OverlapImdctBatchLane)(ImdctBatch* batch, int lane, double* output);
+	void(*DequantizeQuantUnit)(const Channel* source, double* spectra, int band, double scale);
+	void(*DequantizeQuantUnits)(Channel** channels, int channelCount, int band);
+	void(*ScaleSpectrum)(double* spectra, double scale, int start, int end);
+	void(*MirrorSpectrum)(double* spectra, int start, int end);
+	void(*PcmFloatToShort)(double** channels, int channelCount, int sampleCount, short* pcmOut);
+} KernelTable;
+
+extern KernelTable Kernels;
+
+void InitDispatch();
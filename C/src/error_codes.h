@@ -22,7 +22,16 @@ typedef enum At9Status
 	ERR_UNPACK_SCALE_FACTOR_MODE_INVALID,
 	ERR_UNPACK_SCALE_FACTOR_OOB,
 
-	ERR_UNPACK_EXTENSION_DATA_INVALID
+	ERR_UNPACK_EXTENSION_DATA_INVALID,
+
+	ERR_OPTION_CHANNEL_MASK_INVALID = 0x83000000,
+	ERR_OPTION_DOWNMIX_INVALID,
+	ERR_OPTION_FIXED_POINT_CONFLICT,
+
+	ERR_MIX_BUS_FORMAT_INVALID = 0x84000000,
+	ERR_MIX_BUS_FORMAT_MISMATCH,
+
+	ERR_BATCH_HANDLE_DUPLICATE = 0x85000000
 } At9Status;
 
 #define ERROR_CHECK(x) do { \
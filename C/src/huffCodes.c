@@ -2,16 +2,36 @@
 #include "utility.h"
 #include <stdint.h>
 
-int ReadHuffmanValue(const HuffmanCodebook* huff, BitReaderCxt* br, int isSigned)
+// Uses the codebook's multi lookup, if given, to take as many whole codes
+// as fit in one peek. The last few values fall back to one code at a time so no
+// more than count codes are consumed.
+void ReadHuffmanValues(const HuffmanCodebook* huff, const HuffmanMultiEntry* multi, BitReaderCxt* br, int isSigned, int count, int* values)
 {
-	const int code = PeekInt(br, huff->MaxBitSize);
-	const unsigned char value = huff->Lookup[code];
-	const int bits = huff->Bits[value];
-	br->Position += bits;
-	return isSigned ? SignExtend32(value, huff->ValueBits) : value;
+	int i = 0;
+
+	if (multi)
+	{
+		while (count - i >= HUFFMAN_MULTI_VALUES)
+		{
+			const HuffmanMultiEntry* entry = &multi[PeekInt(br, HUFFMAN_MULTI_BITS)];
+			if (entry->Count == 0) break;
+
+			for (int j = 0; j < entry->Count; j++)
+			{
+				values[i + j] = isSigned ? SignExtend32(entry->Values[j], huff->ValueBits) : entry->Values[j];
+			}
+			br->Position += entry->Bits;
+			i += entry->Count;
+		}
+	}
+
+	for (; i < count; i++)
+	{
+		values[i] = ReadHuffmanValue(huff, br, isSigned);
+	}
 }
 
-void DecodeHuffmanValues(int* spectrum, int index, int bandCount, const HuffmanCodebook* huff, const int* values)
+void DecodeHuffmanValues(short* spectrum, int index, int bandCount, const HuffmanCodebook* huff, const int* values)
 {
 	const int valueCount = bandCount >> huff->ValueCountPower;
 	const int mask = (1 << huff->ValueBits) - 1;
@@ -21,7 +41,7 @@ void DecodeHuffmanValues(int* spectrum, int index, int bandCount, const HuffmanC
 		int value = values[i];
 		for (int j = 0; j < huff->ValueCount; j++)
 		{
-			spectrum[index++] = SignExtend32(value & mask, huff->ValueBits);
+			spectrum[index++] = (short)SignExtend32(value & mask, huff->ValueBits);
 			value >>= huff->ValueBits;
 		}
 	}
@@ -50,6 +70,31 @@ void InitHuffmanCodebook(const HuffmanCodebook* codebook)
 	}
 }
 
+// Every possible peek is decoded ahead of time. A code is only taken if
+// all of its bits are inside the peek, which leaves the rest undecided.
+void InitHuffmanMultiLookup(const HuffmanCodebook* codebook, HuffmanMultiEntry* multi)
+{
+	const int windowMask = (1 << HUFFMAN_MULTI_BITS) - 1;
+
+	for (int code = 0; code <= windowMask; code++)
+	{
+		HuffmanMultiEntry* entry = &multi[code];
+		entry->Count = 0;
+		entry->Bits = 0;
+
+		while (entry->Count < HUFFMAN_MULTI_VALUES)
+		{
+			const int window = (code << entry->Bits) & windowMask;
+			const unsigned char value = codebook->Lookup[window >> (HUFFMAN_MULTI_BITS - codebook->MaxBitSize)];
+			const int bits = codebook->Bits[value];
+			if (bits == 0 || entry->Bits + bits > HUFFMAN_MULTI_BITS) break;
+
+			entry->Values[entry->Count++] = value;
+			entry->Bits += bits;
+		}
+	}
+}
+
 static const uint8_t ScaleFactorsA1Bits[2] =
 {
 	1, 1
@@ -1340,6 +1385,9 @@ HuffmanCodebook HuffmanScaleFactorsSigned[6] = {
 	{ScaleFactorsB5Bits, ScaleFactorsB5Codes, ScaleFactorsB5Lookup, 32, 1, 0, 5, 32, 8},
 };
 
+HuffmanMultiEntry HuffmanScaleFactorsUnsignedMulti[7][1 << HUFFMAN_MULTI_BITS];
+HuffmanMultiEntry HuffmanScaleFactorsSignedMulti[6][1 << HUFFMAN_MULTI_BITS];
+
 HuffmanCodebook HuffmanSpectrum[2][8][4] = {
 	{
 		{{0}},
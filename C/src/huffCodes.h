@@ -2,6 +2,18 @@
 
 #include "bit_reader.h"
 
+// Scale factor codes are short, so one peek of HUFFMAN_MULTI_BITS bits
+// usually holds several of them
+#define HUFFMAN_MULTI_BITS 9
+#define HUFFMAN_MULTI_VALUES 6
+
+typedef struct
+{
+	unsigned char Count;
+	unsigned char Bits;
+	unsigned char Values[HUFFMAN_MULTI_VALUES];
+} HuffmanMultiEntry;
+
 typedef struct
 {
 	const unsigned char* Bits;
@@ -15,10 +27,22 @@ typedef struct
 	const int MaxBitSize;
 } HuffmanCodebook;
 
-int ReadHuffmanValue(const HuffmanCodebook* huff, BitReaderCxt* br, int isSigned);
-void DecodeHuffmanValues(int* spectrum, int index, int bandCount, const HuffmanCodebook* huff, const int* values);
+void ReadHuffmanValues(const HuffmanCodebook* huff, const HuffmanMultiEntry* multi, BitReaderCxt* br, int isSigned, int count, int* values);
+void DecodeHuffmanValues(short* spectrum, int index, int bandCount, const HuffmanCodebook* huff, const int* values);
 void InitHuffmanCodebook(const HuffmanCodebook* codebook);
+void InitHuffmanMultiLookup(const HuffmanCodebook* codebook, HuffmanMultiEntry* multi);
 
 extern HuffmanCodebook HuffmanScaleFactorsUnsigned[7];
 extern HuffmanCodebook HuffmanScaleFactorsSigned[6];
 extern HuffmanCodebook HuffmanSpectrum[2][8][4];
+extern HuffmanMultiEntry HuffmanScaleFactorsUnsignedMulti[7][1 << HUFFMAN_MULTI_BITS];
+extern HuffmanMultiEntry HuffmanScaleFactorsSignedMulti[6][1 << HUFFMAN_MULTI_BITS];
+
+static inline int ReadHuffmanValue(const HuffmanCodebook* huff, BitReaderCxt* br, int isSigned)
+{
+	const int code = PeekInt(br, huff->MaxBitSize);
+	const unsigned char value = huff->Lookup[code];
+	const int bits = huff->Bits[value];
+	br->Position += bits;
+	return isSigned ? SignExtend32(value, huff->ValueBits) : value;
+}
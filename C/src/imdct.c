@@ -1,82 +1,287 @@
 #include "imdct.h"
+#include "dispatch.h"
 #include "tables.h"
+#include "utility.h"
+#include <string.h>
 
-static void Dct4(Mdct* mdct, double* input, double* output);
+static int Dct4PretwiddleLane(ImdctBatch* batch, int lane, double* input, int inputBins);
+static void Dct4Fixed(Mdct* mdct, int* input, int inputBins, int* output);
+static void ButterflyFixed(int* front, int* back, int64_t sin, int64_t cos);
 
-void RunImdct(Atrac9Handle* handle, Mdct* mdct, double* input, double* output)
+// Bins from inputBins upward must be zero. The transform is written
+// straight to output and windowed there in place. Positions i, i + half,
+// half - 1 - i and size - 1 - i only depend on each other, so each such
+// group is read before any of it is overwritten.
+void RunImdct(Mdct* mdct, double* input, int inputBins, double* output)
+{
+	const int size = 1 << mdct->Bits;
+	const int half = size / 2;
+	const double* window = ImdctWindow[mdct->Bits - 6];
+	double* previous = mdct->ImdctPrevious;
+
+	Kernels.Dct4(mdct, input, inputBins, output);
+
+	for (int i = 0; i < half / 2; i++)
+	{
+		const int j = half - 1 - i;
+		const double front = output[i];
+		const double back = output[i + half];
+		const double mirrorFront = output[j];
+		const double mirrorBack = output[j + half];
+
+		output[i] = window[i] * back + previous[i];
+		output[i + half] = window[i + half] * -mirrorBack - previous[i + half];
+		previous[i] = window[size - 1 - i] * -mirrorFront;
+		previous[i + half] = window[half - i - 1] * front;
+
+		output[j] = window[j] * mirrorBack + previous[j];
+		output[j + half] = window[j + half] * -back - previous[j + half];
+		previous[j] = window[size - 1 - j] * -front;
+		previous[j + half] = window[half - j - 1] * mirrorFront;
+	}
+}
+
+// With an all-zero spectrum only the overlap from the previous frame remains
+void RunImdctSilent(Mdct* mdct, double* output)
+{
+	const int size = 1 << mdct->Bits;
+	const int half = size / 2;
+	double* previous = mdct->ImdctPrevious;
+
+	for (int i = 0; i < half; i++)
+	{
+		output[i] = previous[i];
+		output[i + half] = -previous[i + half];
+	}
+
+	memset(previous, 0, size * sizeof(double));
+}
+
+// RunImdct on FixedSpectra, with the overlap kept in FixedImdctPrevious
+void RunImdctFixed(Mdct* mdct, int* input, int inputBins, int* output)
+{
+	const int size = 1 << mdct->Bits;
+	const int half = size / 2;
+	const int* window = FixedImdctWindow[mdct->Bits - 6];
+	int* previous = mdct->FixedImdctPrevious;
+
+	Dct4Fixed(mdct, input, inputBins, output);
+
+	for (int i = 0; i < half / 2; i++)
+	{
+		const int j = half - 1 - i;
+		const int64_t front = output[i];
+		const int64_t back = output[i + half];
+		const int64_t mirrorFront = output[j];
+		const int64_t mirrorBack = output[j + half];
+
+		output[i] = Saturate32(RoundShift64(window[i] * back, FIXED_WINDOW_BITS) + previous[i]);
+		output[i + half] = Saturate32(RoundShift64(window[i + half] * -mirrorBack, FIXED_WINDOW_BITS) - previous[i + half]);
+		previous[i] = Saturate32(RoundShift64(window[size - 1 - i] * -mirrorFront, FIXED_WINDOW_BITS));
+		previous[i + half] = Saturate32(RoundShift64(window[half - i - 1] * front, FIXED_WINDOW_BITS));
+
+		output[j] = Saturate32(RoundShift64(window[j] * mirrorBack, FIXED_WINDOW_BITS) + previous[j]);
+		output[j + half] = Saturate32(RoundShift64(window[j + half] * -back, FIXED_WINDOW_BITS) - previous[j + half]);
+		previous[j] = Saturate32(RoundShift64(window[size - 1 - j] * -front, FIXED_WINDOW_BITS));
+		previous[j + half] = Saturate32(RoundShift64(window[half - j - 1] * mirrorFront, FIXED_WINDOW_BITS));
+	}
+}
+
+void RunImdctSilentFixed(Mdct* mdct, int* output)
+{
+	const int size = 1 << mdct->Bits;
+	const int half = size / 2;
+	int* previous = mdct->FixedImdctPrevious;
+
+	for (int i = 0; i < half; i++)
+	{
+		output[i] = previous[i];
+		output[i + half] = Saturate32(-(int64_t)previous[i + half]);
+	}
+
+	memset(previous, 0, size * sizeof(int));
+}
+
+void RunImdctMix(Mdct* mdct, double* input, int inputBins, float* output, int stride, double gain)
 {
 	const int size = 1 << mdct->Bits;
 	const int half = size / 2;
 	double dctOut[MAX_FRAME_SAMPLES];
-	const double* window = handle->ImdctWindow[mdct->Bits - 6];
+	const double* window = ImdctWindow[mdct->Bits - 6];
 	double* previous = mdct->ImdctPrevious;
 
-	Dct4(mdct, input, dctOut);
+	Kernels.Dct4(mdct, input, inputBins, dctOut);
 
 	for (int i = 0; i < half; i++)
 	{
-		output[i] = window[i] * dctOut[i + half] + previous[i];
-		output[i + half] = window[i + half] * -dctOut[size - 1 - i] - previous[i + half];
+		const double front = window[i] * dctOut[i + half] + previous[i];
+		const double back = window[i + half] * -dctOut[size - 1 - i] - previous[i + half];
+		output[i * stride] += (float)(front * gain);
+		output[(i + half) * stride] += (float)(back * gain);
 		previous[i] = window[size - 1 - i] * -dctOut[half - i - 1];
 		previous[i + half] = window[half - i - 1] * dctOut[i];
 	}
 }
 
-static void Dct4(Mdct* mdct, double* input, double* output)
+// The input is consumed right away, so it may be reused before the batch
+// runs. A full batch, or one holding a different transform size, is run
+// first.
+void AddToImdctBatch(ImdctBatch* batch, Mdct* mdct, double* input, int inputBins, double* output)
+{
+	if (batch->Count == IMDCT_BATCH_SIZE || (batch->Count > 0 && batch->Bits != mdct->Bits))
+	{
+		RunImdctBatch(batch);
+	}
+
+	const int lane = batch->Count++;
+	if (lane == 0)
+	{
+		batch->Bits = mdct->Bits;
+		batch->SparsePairs = 1;
+	}
+
+	batch->Mdct[lane] = mdct;
+	batch->Output[lane] = output;
+	batch->SparsePairs = Max(batch->SparsePairs, Dct4PretwiddleLane(batch, lane, input, inputBins));
+}
+
+void RunImdctBatch(ImdctBatch* batch)
+{
+	Kernels.TransformImdctBatch(batch);
+
+	for (int lane = 0; lane < batch->Count; lane++)
+	{
+		Kernels.OverlapImdctBatchLane(batch, lane, batch->Output[lane]);
+	}
+
+	batch->Count = 0;
+}
+
+void TransformImdctBatch(ImdctBatch* batch)
+{
+	Kernels.TransformImdctBatch(batch);
+}
+
+void OverlapImdctBatchLane(ImdctBatch* batch, int lane, double* output)
+{
+	Kernels.OverlapImdctBatchLane(batch, lane, output);
+}
+
+// The first step of Dct4 for one lane. Returns the lane's sparse range.
+static int Dct4PretwiddleLane(ImdctBatch* batch, int lane, double* input, int inputBins)
+{
+	const int size = 1 << batch->Bits;
+	const int lastIndex = size - 1;
+	const int halfSize = size / 2;
+	const double* sinTable = SinTables[batch->Bits];
+	const double* cosTable = CosTables[batch->Bits];
+	const int sparsePairs = Max((Min(inputBins, size) + 1) / 2, 1);
+	double (*data)[IMDCT_BATCH_SIZE] = batch->Data;
+
+	for (int i = 0; i < halfSize; i++)
+	{
+		if (i == sparsePairs && sparsePairs < halfSize - sparsePairs)
+		{
+			for (int j = i * 2; j < (halfSize - sparsePairs) * 2; j++)
+			{
+				data[j][lane] = 0;
+			}
+			i = halfSize - sparsePairs;
+		}
+
+		int i2 = i * 2;
+		double a = input[i2];
+		double b = input[lastIndex - i2];
+		double sin = sinTable[i];
+		double cos = cosTable[i];
+		data[i2][lane] = a * cos + b * sin;
+		data[i2 + 1][lane] = a * sin - b * cos;
+	}
+
+	return sparsePairs;
+}
+
+// Dct4 in fixed point. Twiddles have FIXED_TRIG_BITS fractional bits and
+// every butterfly saturates, so overloaded input clips instead of wrapping.
+static void Dct4Fixed(Mdct* mdct, int* input, int inputBins, int* output)
 {
 	int MdctBits = mdct->Bits;
 	int MdctSize = 1 << MdctBits;
-	const int* shuffleTable = ShuffleTables[MdctBits];
-	const double* sinTable = SinTables[MdctBits];
-	const double* cosTable = CosTables[MdctBits];
-	double dctTemp[MAX_FRAME_SAMPLES];
+	const int* sinTable = FixedSinTables[MdctBits];
+	const int* cosTable = FixedCosTables[MdctBits];
+	int dctTemp[MAX_FRAME_SAMPLES];
 
 	int size = MdctSize;
 	int lastIndex = size - 1;
 	int halfSize = size / 2;
+	int sparsePairs = Max((Min(inputBins, size) + 1) / 2, 1);
 
 	for (int i = 0; i < halfSize; i++)
 	{
+		if (i == sparsePairs && sparsePairs < halfSize - sparsePairs)
+		{
+			memset(&dctTemp[i * 2], 0, (halfSize - sparsePairs * 2) * 2 * sizeof(int));
+			i = halfSize - sparsePairs;
+		}
+
 		int i2 = i * 2;
-		double a = input[i2];
-		double b = input[lastIndex - i2];
-		double sin = sinTable[i];
-		double cos = cosTable[i];
-		dctTemp[i2] = a * cos + b * sin;
-		dctTemp[i2 + 1] = a * sin - b * cos;
+		int64_t a = input[i2];
+		int64_t b = input[lastIndex - i2];
+		int64_t sin = sinTable[i];
+		int64_t cos = cosTable[i];
+		dctTemp[i2] = Saturate32(RoundShift64(a * cos + b * sin, FIXED_TRIG_BITS));
+		dctTemp[i2 + 1] = Saturate32(RoundShift64(a * sin - b * cos, FIXED_TRIG_BITS));
 	}
 	int stageCount = MdctBits - 1;
 
-	for (int stage = 0; stage < stageCount; stage++)
+	for (int stage = 0; stage < stageCount - 2; stage++)
 	{
 		int blockCount = 1 << stage;
 		int blockSizeBits = stageCount - stage;
 		int blockHalfSizeBits = blockSizeBits - 1;
 		int blockSize = 1 << blockSizeBits;
 		int blockHalfSize = 1 << blockHalfSizeBits;
-		sinTable = SinTables[blockHalfSizeBits];
-		cosTable = CosTables[blockHalfSizeBits];
+		sinTable = FixedSinTables[blockHalfSizeBits];
+		cosTable = FixedCosTables[blockHalfSizeBits];
+		int sparse = sparsePairs * 2 <= blockHalfSize;
 
 		for (int block = 0; block < blockCount; block++)
 		{
 			for (int i = 0; i < blockHalfSize; i++)
 			{
+				if (sparse && i == sparsePairs)
+				{
+					i = blockHalfSize - sparsePairs;
+				}
+
 				int frontPos = (block * blockSize + i) * 2;
 				int backPos = frontPos + blockSize;
-				double a = dctTemp[frontPos] - dctTemp[backPos];
-				double b = dctTemp[frontPos + 1] - dctTemp[backPos + 1];
-				double sin = sinTable[i];
-				double cos = cosTable[i];
-				dctTemp[frontPos] += dctTemp[backPos];
-				dctTemp[frontPos + 1] += dctTemp[backPos + 1];
-				dctTemp[backPos] = a * cos + b * sin;
-				dctTemp[backPos + 1] = a * sin - b * cos;
+				ButterflyFixed(&dctTemp[frontPos], &dctTemp[backPos], sinTable[i], cosTable[i]);
 			}
 		}
 	}
 
-	for (int i = 0; i < MdctSize; i++)
+	const int* inverseShuffle = InverseShuffleTables[MdctBits];
+
+	for (int group = 0; group < MdctSize; group += 8)
 	{
-		output[i] = dctTemp[shuffleTable[i]];
+		int* v = &dctTemp[group];
+
+		ButterflyFixed(&v[0], &v[4], FixedSinTables[1][0], FixedCosTables[1][0]);
+		ButterflyFixed(&v[2], &v[6], FixedSinTables[1][1], FixedCosTables[1][1]);
+		ButterflyFixed(&v[0], &v[2], FixedSinTables[0][0], FixedCosTables[0][0]);
+		ButterflyFixed(&v[4], &v[6], FixedSinTables[0][0], FixedCosTables[0][0]);
+
+		for (int k = 0; k < 8; k++) output[inverseShuffle[group + k]] = v[k];
 	}
-}
\ No newline at end of file
+}
+
+static void ButterflyFixed(int* front, int* back, int64_t sin, int64_t cos)
+{
+	int64_t a = (int64_t)front[0] - back[0];
+	int64_t b = (int64_t)front[1] - back[1];
+	front[0] = Saturate32((int64_t)front[0] + back[0]);
+	front[1] = Saturate32((int64_t)front[1] + back[1]);
+	back[0] = Saturate32(RoundShift64(a * cos + b * sin, FIXED_TRIG_BITS));
+	back[1] = Saturate32(RoundShift64(a * sin - b * cos, FIXED_TRIG_BITS));
+}
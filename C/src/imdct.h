@@ -2,4 +2,12 @@
 
 #include "structures.h"
 
-void RunImdct(Atrac9Handle* handle, Mdct* mdct, double* input, double* output);
+void RunImdct(Mdct* mdct, double* input, int inputBins, double* output);
+void RunImdctSilent(Mdct* mdct, double* output);
+void RunImdctFixed(Mdct* mdct, int* input, int inputBins, int* output);
+void RunImdctSilentFixed(Mdct* mdct, int* output);
+void RunImdctMix(Mdct* mdct, double* input, int inputBins, float* output, int stride, double gain);
+void AddToImdctBatch(ImdctBatch* batch, Mdct* mdct, double* input, int inputBins, double* output);
+void RunImdctBatch(ImdctBatch* batch);
+void TransformImdctBatch(ImdctBatch* batch);
+void OverlapImdctBatchLane(ImdctBatch* batch, int lane, double* output);
@@ -0,0 +1,715 @@
+#include "kernels.h"
+#include "dct4_codelets.h"
+#include "tables.h"
+#include "utility.h"
+#include <string.h>
+
+// The kernels that have a variant per instruction set. This file is also
+// built by kernels_sse41.c, kernels_avx2.c and kernels_avx512.c with KERNEL
+// renaming every entry point. Each vector path does the same operations
+// per value as the scalar code, and no fused multiply-adds are used, which
+// keeps the variants bit-exact with each other.
+#ifndef KERNEL
+#define KERNEL(name) name##Generic
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KERNELS_SSE2
+#endif
+
+// MSVC has no SSE4.1 switch, so kernels_sse41.c defines this itself there
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define KERNELS_SSE41
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#elif defined(KERNELS_SSE41)
+#include <smmintrin.h>
+#elif defined(KERNELS_SSE2)
+#include <emmintrin.h>
+#endif
+
+static inline void ButterflyLanes(double (*front)[IMDCT_BATCH_SIZE], double (*back)[IMDCT_BATCH_SIZE], const double* sinTable, const double* cosTable, int pairCount, int count);
+static short ToShort(double x);
+
+#ifdef KERNELS_SSE2
+static __m128i Convert8(const double* samples);
+static void ConvertMono(double** channels, int sampleCount, short* pcmOut);
+static void ConvertStereo(double** channels, int sampleCount, short* pcmOut);
+static void ConvertTransposed(double** channels, int channelCount, int sampleCount, short* pcmOut);
+#endif
+
+// When only the lowest inputBins bins are non-zero, each block of every
+// butterfly stage holds non-zero pairs only within sparsePairs of either
+// end. The zero pairs in between are skipped until the blocks get too
+// small for that to hold. Blocks of 128 values or fewer are finished by
+// the generated codelets, so only a 256 bin transform runs a stage here.
+void KERNEL(Dct4)(Mdct* mdct, double* input, int inputBins, double* output)
+{
+	int MdctBits = mdct->Bits;
+	int MdctSize = 1 << MdctBits;
+	const double* sinTable = SinTables[MdctBits];
+	const double* cosTable = CosTables[MdctBits];
+	double dctTemp[MAX_FRAME_SAMPLES];
+
+	int size = MdctSize;
+	int lastIndex = size - 1;
+	int halfSize = size / 2;
+	int sparsePairs = Max((Min(inputBins, size) + 1) / 2, 1);
+
+	for (int i = 0; i < halfSize; i++)
+	{
+		if (i == sparsePairs && sparsePairs < halfSize - sparsePairs)
+		{
+			memset(&dctTemp[i * 2], 0, (halfSize - sparsePairs * 2) * 2 * sizeof(double));
+			i = halfSize - sparsePairs;
+		}
+
+		int i2 = i * 2;
+		double a = input[i2];
+		double b = input[lastIndex - i2];
+		double sin = sinTable[i];
+		double cos = cosTable[i];
+		dctTemp[i2] = a * cos + b * sin;
+		dctTemp[i2 + 1] = a * sin - b * cos;
+	}
+	int stageCount = MdctBits - 1;
+	int loopStages = Max(MdctBits - 7, 0);
+
+	for (int stage = 0; stage < loopStages; stage++)
+	{
+		int blockCount = 1 << stage;
+		int blockSizeBits = stageCount - stage;
+		int blockHalfSizeBits = blockSizeBits - 1;
+		int blockSize = 1 << blockSizeBits;
+		int blockHalfSize = 1 << blockHalfSizeBits;
+		sinTable = SinTables[blockHalfSizeBits];
+		cosTable = CosTables[blockHalfSizeBits];
+		int sparse = sparsePairs * 2 <= blockHalfSize;
+
+		for (int block = 0; block < blockCount; block++)
+		{
+			for (int i = 0; i < blockHalfSize; i++)
+			{
+				if (sparse && i == sparsePairs)
+				{
+					i = blockHalfSize - sparsePairs;
+				}
+
+				int frontPos = (block * blockSize + i) * 2;
+				int backPos = frontPos + blockSize;
+				double a = dctTemp[frontPos] - dctTemp[backPos];
+				double b = dctTemp[frontPos + 1] - dctTemp[backPos + 1];
+				double sin = sinTable[i];
+				double cos = cosTable[i];
+				dctTemp[frontPos] += dctTemp[backPos];
+				dctTemp[frontPos + 1] += dctTemp[backPos + 1];
+				dctTemp[backPos] = a * cos + b * sin;
+				dctTemp[backPos + 1] = a * sin - b * cos;
+			}
+		}
+	}
+
+	switch (MdctBits)
+	{
+	case 6:
+		Dct4Stages64(dctTemp, output);
+		break;
+	case 7:
+		Dct4Stages128(dctTemp, output);
+		break;
+	default:
+		Dct4Stages256Half(dctTemp, output, output + 1);
+		Dct4Stages256Half(dctTemp + 128, output + 1, output);
+		break;
+	}
+}
+
+// Runs pairCount butterflies on every lane, the k-th between the pairs of
+// rows starting at front[k * 2] and back[k * 2] with the k-th table values.
+// The vector loads stop at count, so the unused lanes of a batch are never
+// read. Masking costs more than it saves on a batch of 4 lanes or fewer.
+static inline void ButterflyLanes(double (*front)[IMDCT_BATCH_SIZE], double (*back)[IMDCT_BATCH_SIZE], const double* sinTable, const double* cosTable, int pairCount, int count)
+{
+	for (int k = 0; k < pairCount; k++)
+	{
+		double* f = front[k * 2];
+		double* fOdd = front[k * 2 + 1];
+		double* b = back[k * 2];
+		double* bOdd = back[k * 2 + 1];
+		const double sin = sinTable[k];
+		const double cos = cosTable[k];
+		int c = 0;
+
+#ifdef __AVX512F__
+		if (count > 4)
+		{
+			const __mmask8 mask = (__mmask8)((1 << count) - 1);
+			const __m512d sin8 = _mm512_set1_pd(sin);
+			const __m512d cos8 = _mm512_set1_pd(cos);
+			const __m512d x = _mm512_maskz_loadu_pd(mask, f);
+			const __m512d xOdd = _mm512_maskz_loadu_pd(mask, fOdd);
+			const __m512d y = _mm512_maskz_loadu_pd(mask, b);
+			const __m512d yOdd = _mm512_maskz_loadu_pd(mask, bOdd);
+			const __m512d p = _mm512_sub_pd(x, y);
+			const __m512d q = _mm512_sub_pd(xOdd, yOdd);
+			_mm512_mask_storeu_pd(f, mask, _mm512_add_pd(x, y));
+			_mm512_mask_storeu_pd(fOdd, mask, _mm512_add_pd(xOdd, yOdd));
+			_mm512_mask_storeu_pd(b, mask, _mm512_add_pd(_mm512_mul_pd(p, cos8), _mm512_mul_pd(q, sin8)));
+			_mm512_mask_storeu_pd(bOdd, mask, _mm512_sub_pd(_mm512_mul_pd(p, sin8), _mm512_mul_pd(q, cos8)));
+			continue;
+		}
+#endif
+
+#ifdef __AVX2__
+		for (; c + 4 <= count; c += 4)
+		{
+			const __m256d sin4 = _mm256_set1_pd(sin);
+			const __m256d cos4 = _mm256_set1_pd(cos);
+			const __m256d x = _mm256_loadu_pd(f + c);
+			const __m256d xOdd = _mm256_loadu_pd(fOdd + c);
+			const __m256d y = _mm256_loadu_pd(b + c);
+			const __m256d yOdd = _mm256_loadu_pd(bOdd + c);
+			const __m256d p = _mm256_sub_pd(x, y);
+			const __m256d q = _mm256_sub_pd(xOdd, yOdd);
+			_mm256_storeu_pd(f + c, _mm256_add_pd(x, y));
+			_mm256_storeu_pd(fOdd + c, _mm256_add_pd(xOdd, yOdd));
+			_mm256_storeu_pd(b + c, _mm256_add_pd(_mm256_mul_pd(p, cos4), _mm256_mul_pd(q, sin4)));
+			_mm256_storeu_pd(bOdd + c, _mm256_sub_pd(_mm256_mul_pd(p, sin4), _mm256_mul_pd(q, cos4)));
+		}
+#endif
+
+#ifdef KERNELS_SSE2
+		for (; c + 2 <= count; c += 2)
+		{
+			const __m128d sin2 = _mm_set1_pd(sin);
+			const __m128d cos2 = _mm_set1_pd(cos);
+			const __m128d x = _mm_loadu_pd(f + c);
+			const __m128d xOdd = _mm_loadu_pd(fOdd + c);
+			const __m128d y = _mm_loadu_pd(b + c);
+			const __m128d yOdd = _mm_loadu_pd(bOdd + c);
+			const __m128d p = _mm_sub_pd(x, y);
+			const __m128d q = _mm_sub_pd(xOdd, yOdd);
+			_mm_storeu_pd(f + c, _mm_add_pd(x, y));
+			_mm_storeu_pd(fOdd + c, _mm_add_pd(xOdd, yOdd));
+			_mm_storeu_pd(b + c, _mm_add_pd(_mm_mul_pd(p, cos2), _mm_mul_pd(q, sin2)));
+			_mm_storeu_pd(bOdd + c, _mm_sub_pd(_mm_mul_pd(p, sin2), _mm_mul_pd(q, cos2)));
+		}
+#endif
+
+		for (; c < count; c++)
+		{
+			double p = f[c] - b[c];
+			double q = fOdd[c] - bOdd[c];
+			f[c] += b[c];
+			fOdd[c] += bOdd[c];
+			b[c] = p * cos + q * sin;
+			bOdd[c] = p * sin - q * cos;
+		}
+	}
+}
+
+// Runs the butterfly stages of every transform in the batch. The data is
+// laid out as [coefficient][lane], so each butterfly works on whole rows
+// of lanes at once. Each lane gets the same operations as Dct4.
+void KERNEL(TransformImdctBatch)(ImdctBatch* batch)
+{
+	const int count = batch->Count;
+	const int sparsePairs = batch->SparsePairs;
+	const int stageCount = batch->Bits - 1;
+	double (*data)[IMDCT_BATCH_SIZE] = batch->Data;
+
+	if (count == 0) return;
+
+	for (int stage = 0; stage < stageCount - 2; stage++)
+	{
+		int blockCount = 1 << stage;
+		int blockSizeBits = stageCount - stage;
+		int blockHalfSizeBits = blockSizeBits - 1;
+		int blockSize = 1 << blockSizeBits;
+		int blockHalfSize = 1 << blockHalfSizeBits;
+		const double* sinTable = SinTables[blockHalfSizeBits];
+		const double* cosTable = CosTables[blockHalfSizeBits];
+		int sparse = sparsePairs * 2 <= blockHalfSize;
+
+		for (int block = 0; block < blockCount; block++)
+		{
+			double (*front)[IMDCT_BATCH_SIZE] = &data[block * blockSize * 2];
+			double (*back)[IMDCT_BATCH_SIZE] = front + blockSize;
+
+			if (!sparse)
+			{
+				ButterflyLanes(front, back, sinTable, cosTable, blockHalfSize, count);
+				continue;
+			}
+
+			int skip = blockHalfSize - sparsePairs;
+			ButterflyLanes(front, back, sinTable, cosTable, sparsePairs, count);
+			ButterflyLanes(front + skip * 2, back + skip * 2, sinTable + skip, cosTable + skip, sparsePairs, count);
+		}
+	}
+
+	// The last two stages work on groups of 4 pairs. The first butterflies
+	// of a group use the two values of the size 2 tables.
+	for (int group = 0; group < 1 << batch->Bits; group += 8)
+	{
+		double (*v)[IMDCT_BATCH_SIZE] = &data[group];
+
+		ButterflyLanes(v, v + 4, SinTables[1], CosTables[1], 2, count);
+		ButterflyLanes(v, v + 2, SinTables[0], CosTables[0], 1, count);
+		ButterflyLanes(v + 4, v + 6, SinTables[0], CosTables[0], 1, count);
+	}
+}
+
+// Windows a transformed lane and overlaps it with the previous frame.
+// The bit-reverse shuffle is folded into the reads, which gather the lane
+// from rows IMDCT_BATCH_SIZE values apart. The reads from the end of the
+// shuffle and window tables are reversed to line up with i.
+void KERNEL(OverlapImdctBatchLane)(ImdctBatch* batch, int lane, double* output)
+{
+	const int size = 1 << batch->Bits;
+	const int half = size / 2;
+	const int* shuffle = ShuffleTables[batch->Bits];
+	const double* window = ImdctWindow[batch->Bits - 6];
+	double* previous = batch->Mdct[lane]->ImdctPrevious;
+	double (*data)[IMDCT_BATCH_SIZE] = batch->Data;
+	const double* column = &data[0][lane];
+	int i = 0;
+
+#if defined(__AVX512F__)
+	const __m256i stride = _mm256_set1_epi32(IMDCT_BATCH_SIZE);
+	const __m256i reverseIndex = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i reverse = _mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i sign = _mm512_set1_epi64((long long)0x8000000000000000ULL);
+
+	for (; i + 8 <= half; i += 8)
+	{
+		const __m256i rows1 = _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(shuffle + i + half)), stride);
+		const __m256i rows2 = _mm256_mullo_epi32(_mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*)(shuffle + size - 8 - i)), reverseIndex), stride);
+		const __m256i rows3 = _mm256_mullo_epi32(_mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*)(shuffle + half - 8 - i)), reverseIndex), stride);
+		const __m256i rows4 = _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(shuffle + i)), stride);
+		const __m512d x1 = _mm512_i32gather_pd(rows1, column, 8);
+		const __m512d x2 = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_i32gather_pd(rows2, column, 8)), sign));
+		const __m512d x3 = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_i32gather_pd(rows3, column, 8)), sign));
+		const __m512d x4 = _mm512_i32gather_pd(rows4, column, 8);
+		const __m512d w3 = _mm512_permutexvar_pd(reverse, _mm512_loadu_pd(window + size - 8 - i));
+		const __m512d w4 = _mm512_permutexvar_pd(reverse, _mm512_loadu_pd(window + half - 8 - i));
+
+		_mm512_storeu_pd(output + i, _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(window + i), x1), _mm512_loadu_pd(previous + i)));
+		_mm512_storeu_pd(output + i + half, _mm512_sub_pd(_mm512_mul_pd(_mm512_loadu_pd(window + i + half), x2), _mm512_loadu_pd(previous + i + half)));
+		_mm512_storeu_pd(previous + i, _mm512_mul_pd(w3, x3));
+		_mm512_storeu_pd(previous + i + half, _mm512_mul_pd(w4, x4));
+	}
+#elif defined(__AVX2__)
+	const __m128i stride = _mm_set1_epi32(IMDCT_BATCH_SIZE);
+	const __m256d sign = _mm256_set1_pd(-0.0);
+
+	for (; i + 4 <= half; i += 4)
+	{
+		const __m128i rows1 = _mm_mullo_epi32(_mm_loadu_si128((const __m128i*)(shuffle + i + half)), stride);
+		const __m128i rows2 = _mm_mullo_epi32(_mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(shuffle + size - 4 - i)), _MM_SHUFFLE(0, 1, 2, 3)), stride);
+		const __m128i rows3 = _mm_mullo_epi32(_mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(shuffle + half - 4 - i)), _MM_SHUFFLE(0, 1, 2, 3)), stride);
+		const __m128i rows4 = _mm_mullo_epi32(_mm_loadu_si128((const __m128i*)(shuffle + i)), stride);
+		const __m256d x1 = _mm256_i32gather_pd(column, rows1, 8);
+		const __m256d x2 = _mm256_xor_pd(_mm256_i32gather_pd(column, rows2, 8), sign);
+		const __m256d x3 = _mm256_xor_pd(_mm256_i32gather_pd(column, rows3, 8), sign);
+		const __m256d x4 = _mm256_i32gather_pd(column, rows4, 8);
+		const __m256d w3 = _mm256_permute4x64_pd(_mm256_loadu_pd(window + size - 4 - i), _MM_SHUFFLE(0, 1, 2, 3));
+		const __m256d w4 = _mm256_permute4x64_pd(_mm256_loadu_pd(window + half - 4 - i), _MM_SHUFFLE(0, 1, 2, 3));
+
+		_mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(window + i), x1), _mm256_loadu_pd(previous + i)));
+		_mm256_storeu_pd(output + i + half, _mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(window + i + half), x2), _mm256_loadu_pd(previous + i + half)));
+		_mm256_storeu_pd(previous + i, _mm256_mul_pd(w3, x3));
+		_mm256_storeu_pd(previous + i + half, _mm256_mul_pd(w4, x4));
+	}
+#elif defined(KERNELS_SSE2)
+	const __m128d sign = _mm_set1_pd(-0.0);
+
+	for (; i + 2 <= half; i += 2)
+	{
+		const __m128d x1 = _mm_set_pd(data[shuffle[i + half + 1]][lane], data[shuffle[i + half]][lane]);
+		const __m128d x2 = _mm_set_pd(data[shuffle[size - 2 - i]][lane], data[shuffle[size - 1 - i]][lane]);
+		const __m128d x3 = _mm_set_pd(data[shuffle[half - i - 2]][lane], data[shuffle[half - i - 1]][lane]);
+		const __m128d x4 = _mm_set_pd(data[shuffle[i + 1]][lane], data[shuffle[i]][lane]);
+		const __m128d w3 = _mm_loadu_pd(window + size - 2 - i);
+		const __m128d w4 = _mm_loadu_pd(window + half - 2 - i);
+
+		_mm_storeu_pd(output + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(window + i), x1), _mm_loadu_pd(previous + i)));
+		_mm_storeu_pd(output + i + half, _mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(window + i + half), _mm_xor_pd(x2, sign)), _mm_loadu_pd(previous + i + half)));
+		_mm_storeu_pd(previous + i, _mm_mul_pd(_mm_shuffle_pd(w3, w3, 1), _mm_xor_pd(x3, sign)));
+		_mm_storeu_pd(previous + i + half, _mm_mul_pd(_mm_shuffle_pd(w4, w4, 1), x4));
+	}
+#endif
+
+	for (; i < half; i++)
+	{
+		output[i] = window[i] * column[shuffle[i + half] * IMDCT_BATCH_SIZE] + previous[i];
+		output[i + half] = window[i + half] * -column[shuffle[size - 1 - i] * IMDCT_BATCH_SIZE] - previous[i + half];
+		previous[i] = window[size - 1 - i] * -column[shuffle[half - i - 1] * IMDCT_BATCH_SIZE];
+		previous[i + half] = window[half - i - 1] * column[shuffle[i] * IMDCT_BATCH_SIZE];
+	}
+}
+
+// The quantized values are widened from short to double in the vector
+// paths. Both conversions are exact, so the products match the scalar ones.
+void KERNEL(DequantizeQuantUnit)(const Channel* source, double* spectra, int band, double scale)
+{
+	const int subBandIndex = QuantUnitToCoeffIndex[band];
+	const int subBandCount = QuantUnitToCoeffCount[band];
+	const double stepSize = QuantizerStepSize[source->Precisions[band]];
+	const double stepSizeFine = QuantizerFineStepSize[source->PrecisionsFine[band]];
+	const short* coarseValues = source->QuantizedSpectra + subBandIndex;
+	const short* fineValues = source->QuantizedSpectraFine + subBandIndex;
+	double* out = spectra + subBandIndex;
+	int sb = 0;
+
+#if defined(__AVX512F__)
+	const __m512d step8 = _mm512_set1_pd(stepSize);
+	const __m512d stepFine8 = _mm512_set1_pd(stepSizeFine);
+	const __m512d scale8 = _mm512_set1_pd(scale);
+
+	for (; sb + 8 <= subBandCount; sb += 8)
+	{
+		const __m512d coarse = _mm512_mul_pd(_mm512_cvtepi32_pd(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(coarseValues + sb)))), step8);
+		const __m512d fine = _mm512_mul_pd(_mm512_cvtepi32_pd(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(fineValues + sb)))), stepFine8);
+		_mm512_storeu_pd(out + sb, _mm512_mul_pd(_mm512_add_pd(coarse, fine), scale8));
+	}
+#elif defined(__AVX2__)
+	const __m256d step4 = _mm256_set1_pd(stepSize);
+	const __m256d stepFine4 = _mm256_set1_pd(stepSizeFine);
+	const __m256d scale4 = _mm256_set1_pd(scale);
+
+	for (; sb + 4 <= subBandCount; sb += 4)
+	{
+		const __m256d coarse = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(coarseValues + sb)))), step4);
+		const __m256d fine = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(fineValues + sb)))), stepFine4);
+		_mm256_storeu_pd(out + sb, _mm256_mul_pd(_mm256_add_pd(coarse, fine), scale4));
+	}
+#elif defined(KERNELS_SSE41)
+	const __m128d step2 = _mm_set1_pd(stepSize);
+	const __m128d stepFine2 = _mm_set1_pd(stepSizeFine);
+	const __m128d scale2 = _mm_set1_pd(scale);
+
+	for (; sb + 4 <= subBandCount; sb += 4)
+	{
+		const __m128i coarse = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(coarseValues + sb)));
+		const __m128i fine = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(fineValues + sb)));
+
+		const __m128d coarseLow = _mm_mul_pd(_mm_cvtepi32_pd(coarse), step2);
+		const __m128d fineLow = _mm_mul_pd(_mm_cvtepi32_pd(fine), stepFine2);
+		const __m128d coarseHigh = _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(coarse, coarse)), step2);
+		const __m128d fineHigh = _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(fine, fine)), stepFine2);
+		_mm_storeu_pd(out + sb, _mm_mul_pd(_mm_add_pd(coarseLow, fineLow), scale2));
+		_mm_storeu_pd(out + sb + 2, _mm_mul_pd(_mm_add_pd(coarseHigh, fineHigh), scale2));
+	}
+#endif
+
+	for (; sb < subBandCount; sb++)
+	{
+		const double coarse = coarseValues[sb] * stepSize;
+		const double fine = fineValues[sb] * stepSizeFine;
+		out[sb] = (coarse + fine) * scale;
+	}
+}
+
+// Dequantizes one unit of each channel, all of which code it. The bottom
+// units are narrower than a vector, so the vector paths fill one with the
+// same unit from two channels. The arithmetic per value is unchanged.
+void KERNEL(DequantizeQuantUnits)(Channel** channels, int channelCount, int band)
+{
+	const int subBandIndex = QuantUnitToCoeffIndex[band];
+	const int subBandCount = QuantUnitToCoeffCount[band];
+	int c = 0;
+
+#if defined(__AVX2__)
+	for (; subBandCount == 2 && c + 2 <= channelCount; c += 2)
+	{
+		Channel* a = channels[c];
+		Channel* b = channels[c + 1];
+		const short* coarseA = a->QuantizedSpectra + subBandIndex;
+		const short* coarseB = b->QuantizedSpectra + subBandIndex;
+		const short* fineA = a->QuantizedSpectraFine + subBandIndex;
+		const short* fineB = b->QuantizedSpectraFine + subBandIndex;
+		const double stepA = QuantizerStepSize[a->Precisions[band]];
+		const double stepB = QuantizerStepSize[b->Precisions[band]];
+		const double stepFineA = QuantizerFineStepSize[a->PrecisionsFine[band]];
+		const double stepFineB = QuantizerFineStepSize[b->PrecisionsFine[band]];
+		const double scaleA = SpectrumScale[a->ScaleFactors[band]];
+		const double scaleB = SpectrumScale[b->ScaleFactors[band]];
+
+		const __m256d coarse = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_setr_epi16(coarseA[0], coarseA[1], coarseB[0], coarseB[1], 0, 0, 0, 0))), _mm256_setr_pd(stepA, stepA, stepB, stepB));
+		const __m256d fine = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_setr_epi16(fineA[0], fineA[1], fineB[0], fineB[1], 0, 0, 0, 0))), _mm256_setr_pd(stepFineA, stepFineA, stepFineB, stepFineB));
+		const __m256d out = _mm256_mul_pd(_mm256_add_pd(coarse, fine), _mm256_setr_pd(scaleA, scaleA, scaleB, scaleB));
+		_mm_storeu_pd(a->Spectra + subBandIndex, _mm256_castpd256_pd128(out));
+		_mm_storeu_pd(b->Spectra + subBandIndex, _mm256_extractf128_pd(out, 1));
+	}
+#elif defined(KERNELS_SSE2)
+	for (; subBandCount == 2 && c + 2 <= channelCount; c += 2)
+	{
+		Channel* a = channels[c];
+		Channel* b = channels[c + 1];
+		const short* coarseA = a->QuantizedSpectra + subBandIndex;
+		const short* coarseB = b->QuantizedSpectra + subBandIndex;
+		const short* fineA = a->QuantizedSpectraFine + subBandIndex;
+		const short* fineB = b->QuantizedSpectraFine + subBandIndex;
+		const __m128i coarse = _mm_setr_epi32(coarseA[0], coarseA[1], coarseB[0], coarseB[1]);
+		const __m128i fine = _mm_setr_epi32(fineA[0], fineA[1], fineB[0], fineB[1]);
+
+		const __m128d coarseLow = _mm_mul_pd(_mm_cvtepi32_pd(coarse), _mm_set1_pd(QuantizerStepSize[a->Precisions[band]]));
+		const __m128d fineLow = _mm_mul_pd(_mm_cvtepi32_pd(fine), _mm_set1_pd(QuantizerFineStepSize[a->PrecisionsFine[band]]));
+		const __m128d coarseHigh = _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(coarse, coarse)), _mm_set1_pd(QuantizerStepSize[b->Precisions[band]]));
+		const __m128d fineHigh = _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(fine, fine)), _mm_set1_pd(QuantizerFineStepSize[b->PrecisionsFine[band]]));
+		_mm_storeu_pd(a->Spectra + subBandIndex, _mm_mul_pd(_mm_add_pd(coarseLow, fineLow), _mm_set1_pd(SpectrumScale[a->ScaleFactors[band]])));
+		_mm_storeu_pd(b->Spectra + subBandIndex, _mm_mul_pd(_mm_add_pd(coarseHigh, fineHigh), _mm_set1_pd(SpectrumScale[b->ScaleFactors[band]])));
+	}
+#endif
+
+#if defined(__AVX512F__)
+	for (; subBandCount == 4 && c + 2 <= channelCount; c += 2)
+	{
+		Channel* a = channels[c];
+		Channel* b = channels[c + 1];
+		const __m128i coarseValues = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(a->QuantizedSpectra + subBandIndex)), _mm_loadl_epi64((const __m128i*)(b->QuantizedSpectra + subBandIndex)));
+		const __m128i fineValues = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(a->QuantizedSpectraFine + subBandIndex)), _mm_loadl_epi64((const __m128i*)(b->QuantizedSpectraFine + subBandIndex)));
+		const __m512d step = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_set1_pd(QuantizerStepSize[a->Precisions[band]])), _mm256_set1_pd(QuantizerStepSize[b->Precisions[band]]), 1);
+		const __m512d stepFine = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_set1_pd(QuantizerFineStepSize[a->PrecisionsFine[band]])), _mm256_set1_pd(QuantizerFineStepSize[b->PrecisionsFine[band]]), 1);
+		const __m512d scale = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_set1_pd(SpectrumScale[a->ScaleFactors[band]])), _mm256_set1_pd(SpectrumScale[b->ScaleFactors[band]]), 1);
+
+		const __m512d coarse = _mm512_mul_pd(_mm512_cvtepi32_pd(_mm256_cvtepi16_epi32(coarseValues)), step);
+		const __m512d fine = _mm512_mul_pd(_mm512_cvtepi32_pd(_mm256_cvtepi16_epi32(fineValues)), stepFine);
+		const __m512d out = _mm512_mul_pd(_mm512_add_pd(coarse, fine), scale);
+		_mm256_storeu_pd(a->Spectra + subBandIndex, _mm512_castpd512_pd256(out));
+		_mm256_storeu_pd(b->Spectra + subBandIndex, _mm512_extractf64x4_pd(out, 1));
+	}
+#endif
+
+#if !defined(KERNELS_SSE2)
+	(void)subBandIndex;
+	(void)subBandCount;
+#endif
+
+	for (; c < channelCount; c++)
+	{
+		KERNEL(DequantizeQuantUnit)(channels[c], channels[c]->Spectra, band, SpectrumScale[channels[c]->ScaleFactors[band]]);
+	}
+}
+
+void KERNEL(ScaleSpectrum)(double* spectra, double scale, int start, int end)
+{
+	int i = start;
+
+#ifdef KERNELS_SSE2
+	const __m128d factor = _mm_set1_pd(scale);
+	for (; i + 2 <= end; i += 2)
+	{
+		_mm_storeu_pd(spectra + i, _mm_mul_pd(_mm_loadu_pd(spectra + i), factor));
+	}
+#endif
+
+	for (; i < end; i++)
+	{
+		spectra[i] *= scale;
+	}
+}
+
+// Copies the bins below start to the ones from start up to end in reverse
+// order. The source always lies below start, so the two never overlap.
+void KERNEL(MirrorSpectrum)(double* spectra, int start, int end)
+{
+	int i = 0;
+
+#ifdef KERNELS_SSE2
+	for (; start + i + 2 <= end; i += 2)
+	{
+		const __m128d source = _mm_loadu_pd(spectra + start - i - 2);
+		_mm_storeu_pd(spectra + start + i, _mm_shuffle_pd(source, source, 1));
+	}
+#endif
+
+	for (; start + i < end; i++)
+	{
+		spectra[start + i] = spectra[start - i - 1];
+	}
+}
+
+// Samples are clamped to just outside the 16-bit range before rounding, so
+// huge values can't overflow Round. Results inside the range are unchanged.
+// The common channel layouts are converted 8 samples at a time.
+void KERNEL(PcmFloatToShort)(double** channels, int channelCount, int sampleCount, short* pcmOut)
+{
+	int i = 0;
+
+#ifdef KERNELS_SSE2
+	if (sampleCount % 8 == 0)
+	{
+		switch (channelCount)
+		{
+		case 1:
+			ConvertMono(channels, sampleCount, pcmOut);
+			return;
+		case 2:
+			ConvertStereo(channels, sampleCount, pcmOut);
+			return;
+		case 6:
+		case 8:
+			ConvertTransposed(channels, channelCount, sampleCount, pcmOut);
+			return;
+		}
+	}
+#endif
+
+	for (int smpl = 0; smpl < sampleCount; smpl++)
+	{
+		for (int ch = 0; ch < channelCount; ch++, i++)
+		{
+			pcmOut[i] = ToShort(channels[ch][smpl]);
+		}
+	}
+}
+
+static short ToShort(double x)
+{
+	if (x > 32768.0) x = 32768.0;
+	if (x < -32769.0) x = -32769.0;
+	return Clamp16(Round(x));
+}
+
+#ifdef KERNELS_SSE2
+#if defined(__AVX2__)
+// Same result as ToShort, rounding with floor(x + 0.5) directly. The
+// saturating pack does Clamp16.
+static __m128i Convert8(const double* samples)
+{
+	const __m256d low = _mm256_set1_pd(-32769.0);
+	const __m256d high = _mm256_set1_pd(32768.0);
+	const __m256d half = _mm256_set1_pd(0.5);
+	__m128i quads[2];
+
+	for (int i = 0; i < 2; i++)
+	{
+		__m256d x = _mm256_loadu_pd(samples + i * 4);
+		x = _mm256_add_pd(_mm256_min_pd(_mm256_max_pd(x, low), high), half);
+		quads[i] = _mm256_cvttpd_epi32(_mm256_floor_pd(x));
+	}
+
+	return _mm_packs_epi32(quads[0], quads[1]);
+}
+#elif defined(KERNELS_SSE41)
+// Same result as ToShort, rounding with floor(x + 0.5) directly. The
+// saturating pack does Clamp16.
+static __m128i Convert8(const double* samples)
+{
+	const __m128d low = _mm_set1_pd(-32769.0);
+	const __m128d high = _mm_set1_pd(32768.0);
+	const __m128d half = _mm_set1_pd(0.5);
+	__m128i pairs[4];
+
+	for (int i = 0; i < 4; i++)
+	{
+		__m128d x = _mm_loadu_pd(samples + i * 2);
+		x = _mm_add_pd(_mm_min_pd(_mm_max_pd(x, low), high), half);
+		pairs[i] = _mm_cvttpd_epi32(_mm_floor_pd(x));
+	}
+
+	return _mm_packs_epi32(_mm_unpacklo_epi64(pairs[0], pairs[1]), _mm_unpacklo_epi64(pairs[2], pairs[3]));
+}
+#else
+// Same result as ToShort. The truncating conversion is turned into Round's
+// floor(x + 0.5), and the saturating pack does Clamp16.
+static __m128i Convert8(const double* samples)
+{
+	const __m128d low = _mm_set1_pd(-32769.0);
+	const __m128d high = _mm_set1_pd(32768.0);
+	const __m128d half = _mm_set1_pd(0.5);
+	__m128i pairs[4];
+
+	for (int i = 0; i < 4; i++)
+	{
+		__m128d x = _mm_loadu_pd(samples + i * 2);
+		x = _mm_add_pd(_mm_min_pd(_mm_max_pd(x, low), high), half);
+
+		__m128i value = _mm_cvttpd_epi32(x);
+		__m128d below = _mm_cmplt_pd(x, _mm_cvtepi32_pd(value));
+		pairs[i] = _mm_add_epi32(value, _mm_shuffle_epi32(_mm_castpd_si128(below), _MM_SHUFFLE(3, 3, 2, 0)));
+	}
+
+	return _mm_packs_epi32(_mm_unpacklo_epi64(pairs[0], pairs[1]), _mm_unpacklo_epi64(pairs[2], pairs[3]));
+}
+#endif
+
+static void ConvertMono(double** channels, int sampleCount, short* pcmOut)
+{
+	for (int i = 0; i < sampleCount; i += 8)
+	{
+		_mm_storeu_si128((__m128i*)(pcmOut + i), Convert8(channels[0] + i));
+	}
+}
+
+static void ConvertStereo(double** channels, int sampleCount, short* pcmOut)
+{
+	for (int i = 0; i < sampleCount; i += 8)
+	{
+		const __m128i left = Convert8(channels[0] + i);
+		const __m128i right = Convert8(channels[1] + i);
+		_mm_storeu_si128((__m128i*)(pcmOut + i * 2), _mm_unpacklo_epi16(left, right));
+		_mm_storeu_si128((__m128i*)(pcmOut + i * 2 + 8), _mm_unpackhi_epi16(left, right));
+	}
+}
+
+// Converts 8 samples of up to 8 channels and transposes the 8x8 block
+// so each row holds one interleaved sample frame. With 6 channels the
+// last two lanes of each row are overwritten by the next row's store.
+static void ConvertTransposed(double** channels, int channelCount, int sampleCount, short* pcmOut)
+{
+	for (int i = 0; i < sampleCount; i += 8)
+	{
+		__m128i r[8];
+
+		for (int ch = 0; ch < 8; ch++)
+		{
+			r[ch] = ch < channelCount ? Convert8(channels[ch] + i) : _mm_setzero_si128();
+		}
+
+		const __m128i t0 = _mm_unpacklo_epi16(r[0], r[1]);
+		const __m128i t1 = _mm_unpackhi_epi16(r[0], r[1]);
+		const __m128i t2 = _mm_unpacklo_epi16(r[2], r[3]);
+		const __m128i t3 = _mm_unpackhi_epi16(r[2], r[3]);
+		const __m128i t4 = _mm_unpacklo_epi16(r[4], r[5]);
+		const __m128i t5 = _mm_unpackhi_epi16(r[4], r[5]);
+		const __m128i t6 = _mm_unpacklo_epi16(r[6], r[7]);
+		const __m128i t7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+		const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+		const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+		const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+		const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+		const __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+		const __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+		const __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+		const __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+		__m128i frames[8];
+		frames[0] = _mm_unpacklo_epi64(u0, u4);
+		frames[1] = _mm_unpackhi_epi64(u0, u4);
+		frames[2] = _mm_unpacklo_epi64(u1, u5);
+		frames[3] = _mm_unpackhi_epi64(u1, u5);
+		frames[4] = _mm_unpacklo_epi64(u2, u6);
+		frames[5] = _mm_unpackhi_epi64(u2, u6);
+		frames[6] = _mm_unpacklo_epi64(u3, u7);
+		frames[7] = _mm_unpackhi_epi64(u3, u7);
+
+		short* out = pcmOut + i * channelCount;
+
+		for (int k = 0; k < 7; k++)
+		{
+			_mm_storeu_si128((__m128i*)(out + k * channelCount), frames[k]);
+		}
+
+		// The last row mustn't write past the end of this block
+		short last[8];
+		_mm_storeu_si128((__m128i*)last, frames[7]);
+		memcpy(out + 7 * channelCount, last, channelCount * sizeof(short));
+	}
+}
+#endif
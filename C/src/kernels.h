@@ -0,0 +1,19 @@
+#pragma once
+
+#include "dispatch.h"
+#include "structures.h"
+
+void Dct4Generic(Mdct* mdct, double* input, int inputBins, double* output);
+void TransformImdctBatchGeneric(ImdctBatch* batch);
+void OverlapImdctBatchLaneGeneric(ImdctBatch* batch, int lane, double* output);
+void DequantizeQuantUnitGeneric(const Channel* source, double* spectra, int band, double scale);
+void DequantizeQuantUnitsGeneric(Channel** channels, int channelCount, int band);
+void ScaleSpectrumGeneric(double* spectra, double scale, int start, int end);
+void MirrorSpectrumGeneric(double* spectra, int start, int end);
+void PcmFloatToShortGeneric(double** channels, int channelCount, int sampleCount, short* pcmOut);
+
+// Each fills the table with one instruction set's build of the kernels.
+// They return FALSE if the library was built without it.
+int GetSse41Kernels(KernelTable* table);
+int GetAvx2Kernels(KernelTable* table);
+int GetAvx512Kernels(KernelTable* table);
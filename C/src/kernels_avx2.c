@@ -0,0 +1,28 @@
+#include "kernels.h"
+#include "utility.h"
+
+#ifdef __AVX2__
+// The kernels rebuilt with AVX2 code generation. Only this file gets the
+// AVX2 compiler flags, so nothing else in the library needs the CPU feature.
+#define KERNEL(name) name##Avx2
+#include "kernels.c"
+
+int GetAvx2Kernels(KernelTable* table)
+{
+	table->Dct4 = Dct4Avx2;
+	table->TransformImdctBatch = TransformImdctBatchAvx2;
+	table->OverlapImdctBatchLane = OverlapImdctBatchLaneAvx2;
+	table->DequantizeQuantUnit = DequantizeQuantUnitAvx2;
+	table->DequantizeQuantUnits = DequantizeQuantUnitsAvx2;
+	table->ScaleSpectrum = ScaleSpectrumAvx2;
+	table->MirrorSpectrum = MirrorSpectrumAvx2;
+	table->PcmFloatToShort = PcmFloatToShortAvx2;
+	return TRUE;
+}
+#else
+int GetAvx2Kernels(KernelTable* table)
+{
+	(void)table;
+	return FALSE;
+}
+#endif
@@ -0,0 +1,29 @@
+#include "kernels.h"
+#include "utility.h"
+
+#ifdef __AVX512F__
+// The kernels rebuilt with AVX-512 code generation. The AVX-512 switches
+// also enable FMA, so this file is built without floating point
+// contraction to stay bit-exact with the other levels.
+#define KERNEL(name) name##Avx512
+#include "kernels.c"
+
+int GetAvx512Kernels(KernelTable* table)
+{
+	table->Dct4 = Dct4Avx512;
+	table->TransformImdctBatch = TransformImdctBatchAvx512;
+	table->OverlapImdctBatchLane = OverlapImdctBatchLaneAvx512;
+	table->DequantizeQuantUnit = DequantizeQuantUnitAvx512;
+	table->DequantizeQuantUnits = DequantizeQuantUnitsAvx512;
+	table->ScaleSpectrum = ScaleSpectrumAvx512;
+	table->MirrorSpectrum = MirrorSpectrumAvx512;
+	table->PcmFloatToShort = PcmFloatToShortAvx512;
+	return TRUE;
+}
+#else
+int GetAvx512Kernels(KernelTable* table)
+{
+	(void)table;
+	return FALSE;
+}
+#endif
@@ -0,0 +1,29 @@
+#include "kernels.h"
+#include "utility.h"
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+// The kernels rebuilt with SSE4.1 code generation. MSVC allows the SSE4.1
+// intrinsics without a compiler switch, so they're enabled here instead.
+#define KERNELS_SSE41
+#define KERNEL(name) name##Sse41
+#include "kernels.c"
+
+int GetSse41Kernels(KernelTable* table)
+{
+	table->Dct4 = Dct4Sse41;
+	table->TransformImdctBatch = TransformImdctBatchSse41;
+	table->OverlapImdctBatchLane = OverlapImdctBatchLaneSse41;
+	table->DequantizeQuantUnit = DequantizeQuantUnitSse41;
+	table->DequantizeQuantUnits = DequantizeQuantUnitsSse41;
+	table->ScaleSpectrum = ScaleSpectrumSse41;
+	table->MirrorSpectrum = MirrorSpectrumSse41;
+	table->PcmFloatToShort = PcmFloatToShortSse41;
+	return TRUE;
+}
+#else
+int GetSse41Kernels(KernelTable* table)
+{
+	(void)table;
+	return FALSE;
+}
+#endif
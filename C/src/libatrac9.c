@@ -2,6 +2,7 @@
 #include "decinit.h"
 #include "decoder.h"
 #include "libatrac9.h"
+#include "mix_bus.h"
 #include "structures.h"
 #include <stdlib.h>
 #include <string.h>
@@ -26,11 +27,83 @@ int LIBATRAC9_API Atrac9Decode(void* handle, const unsigned char *pAtrac9Buffer,
 	return Decode(handle, pAtrac9Buffer, (unsigned char*)pPcmBuffer, pNBytesUsed);
 }
 
+int LIBATRAC9_API Atrac9DecodeSuperframe(void* handle, const unsigned char *pAtrac9Buffer, short *pPcmBuffer, int *pNBytesUsed)
+{
+	return DecodeSuperframe(handle, pAtrac9Buffer, (unsigned char*)pPcmBuffer, pNBytesUsed);
+}
+
+int LIBATRAC9_API Atrac9DecodeMix(void* handle, const unsigned char *pAtrac9Buffer, float *pMixBuffer, const float *pGains, int *pNBytesUsed)
+{
+	return DecodeMix(handle, pAtrac9Buffer, pMixBuffer, pGains, pNBytesUsed);
+}
+
+int LIBATRAC9_API Atrac9DecodeBatch(void** handles, int handleCount, const unsigned char **ppAtrac9Buffers, short **ppPcmBuffers, int *pNBytesUsed)
+{
+	return DecodeBatch((Atrac9Handle**)handles, handleCount, ppAtrac9Buffers, ppPcmBuffers, pNBytesUsed);
+}
+
 int LIBATRAC9_API Atrac9GetCodecInfo(void* handle, Atrac9ConfigData* pCodecInfo)
 {
 	return GetCodecInfo(handle, pCodecInfo);
 }
 
+int LIBATRAC9_API Atrac9IsFrameSilent(void* handle)
+{
+	return IsFrameSilent(handle);
+}
+
+int LIBATRAC9_API Atrac9GetStreamStats(void* handle, Atrac9StreamStats* pStats)
+{
+	return GetStreamStats(handle, pStats);
+}
+
+int LIBATRAC9_API Atrac9SetChannelMask(void* handle, int channelMask)
+{
+	return SetChannelMask(handle, channelMask);
+}
+
+int LIBATRAC9_API Atrac9SetDownmix(void* handle, int outputChannels, const float* pMatrix)
+{
+	return SetDownmix(handle, outputChannels, pMatrix);
+}
+
+int LIBATRAC9_API Atrac9SetFixedPoint(void* handle, int enabled)
+{
+	return SetFixedPoint(handle, enabled);
+}
+
+int LIBATRAC9_API Atrac9GetProfile(void* handle, Atrac9ProfileStats* pStats)
+{
+	return GetProfile(handle, pStats);
+}
+
+void* LIBATRAC9_API Atrac9GetMixBus(int channelCount, int frameSamples)
+{
+	MixBus* bus = malloc(sizeof(MixBus));
+	if (bus != NULL && InitMixBus(bus, channelCount, frameSamples) != ERR_SUCCESS)
+	{
+		free(bus);
+		return NULL;
+	}
+	return bus;
+}
+
+void LIBATRAC9_API Atrac9ReleaseMixBus(void* bus)
+{
+	free(bus);
+}
+
+int LIBATRAC9_API Atrac9MixBusDecode(void* bus, void* handle, const unsigned char *pAtrac9Buffer, const float *pGains, int *pNBytesUsed)
+{
+	return MixBusAddVoice(bus, handle, pAtrac9Buffer, pGains, pNBytesUsed);
+}
+
+int LIBATRAC9_API Atrac9MixBusRender(void* bus, short *pPcmBuffer)
+{
+	MixBusRender(bus, pPcmBuffer);
+	return ERR_SUCCESS;
+}
+
 BOOL NTAPI DllMain(PVOID BaseAddress, ULONG Reason, PVOID Reserved)
 {
     switch (Reason)
@@ -20,6 +20,8 @@ extern "C" {
 #include "structures.h"
 
 typedef ConfigData Atrac9ConfigData;
+typedef ProfileStats Atrac9ProfileStats;
+typedef StreamStats Atrac9StreamStats;
 
 void* LIBATRAC9_API Atrac9GetHandle(void);
 void LIBATRAC9_API Atrac9ReleaseHandle(void* handle);
@@ -27,8 +29,54 @@ void LIBATRAC9_API Atrac9ReleaseHandle(void* handle);
 int LIBATRAC9_API Atrac9InitDecoder(void* handle, unsigned char *pConfigData);
 int LIBATRAC9_API Atrac9Decode(void* handle, const unsigned char *pAtrac9Buffer, short *pPcmBuffer, int *pNBytesUsed);
 
+// Decodes all FramesPerSuperframe frames of a superframe, running their transforms together.
+// pPcmBuffer receives FramesPerSuperframe frames of interleaved samples.
+// On an error, only the frames before the failing one are written and counted in pNBytesUsed (0 if the first fails).
+// Atrac9IsFrameSilent then returns 1 only if every frame written was silent.
+int LIBATRAC9_API Atrac9DecodeSuperframe(void* handle, const unsigned char *pAtrac9Buffer, short *pPcmBuffer, int *pNBytesUsed);
+
+// Adds one frame, scaled by a gain per output channel, into an interleaved float mix buffer.
+// Samples use the same scale as the 16-bit output and are not clamped.
+int LIBATRAC9_API Atrac9DecodeMix(void* handle, const unsigned char *pAtrac9Buffer, float *pMixBuffer, const float *pGains, int *pNBytesUsed);
+
+// Decodes one frame for each of handleCount streams, running their dequantization and transforms together.
+// Streams with the same frame size are batched. ppAtrac9Buffers, ppPcmBuffers and pNBytesUsed hold one entry per handle.
+// Each handle may appear only once; a repeated handle fails with ERR_BATCH_HANDLE_DUPLICATE before anything is decoded.
+int LIBATRAC9_API Atrac9DecodeBatch(void** handles, int handleCount, const unsigned char **ppAtrac9Buffers, short **ppPcmBuffers, int *pNBytesUsed);
+
 int LIBATRAC9_API Atrac9GetCodecInfo(void* handle, Atrac9ConfigData *pCodecInfo);
 
+// Returns 1 if the last decoded frame carried no spectral data for any selected channel.
+// Its output is only the tail of the previous frame, and is all zeros if that frame was silent too.
+int LIBATRAC9_API Atrac9IsFrameSilent(void* handle);
+
+// Copies the counts of coding tools seen in the frames unpacked since Atrac9InitDecoder, including those of
+// channels left out by the channel mask. BexModes only counts blocks whose band extension carries data.
+int LIBATRAC9_API Atrac9GetStreamStats(void* handle, Atrac9StreamStats *pStats);
+
+// Bit N selects channel N. Only selected channels are synthesized and written, interleaved in channel order.
+int LIBATRAC9_API Atrac9SetChannelMask(void* handle, int channelMask);
+
+// Mixes the decoded channels down to 1 or 2 output channels before the IMDCT. pMatrix holds
+// outputChannels rows of ChannelCount gains each. Passing 0 output channels turns downmixing off.
+int LIBATRAC9_API Atrac9SetDownmix(void* handle, int outputChannels, const float *pMatrix);
+
+// Switches the handle between double and fixed-point synthesis. Fixed point can't be combined with downmixing,
+// Atrac9DecodeMix or a mix bus. On the streams generated by "make bench_fixed", 98.99% of output samples match the
+// double path, 99.998% are within 1 LSB and the largest difference is 4 LSBs.
+int LIBATRAC9_API Atrac9SetFixedPoint(void* handle, int enabled);
+
+// Copies the handle's cycle and call counts per decoding stage, indexed by ProfileStage. Each stage counts one call
+// per decoded frame, so Cycles / Calls is its cost per frame. The counts are reset by Atrac9InitDecoder. Returns ERR_NOT_IMPLEMENTED unless the library was built with ATRAC9_PROFILE.
+int LIBATRAC9_API Atrac9GetProfile(void* handle, Atrac9ProfileStats *pStats);
+
+// A mix bus sums the spectra of many voices with the same frame size and runs one IMDCT per bus channel.
+// A voice's output channel count must match the bus. Its own overlap state isn't updated while mixed on a bus.
+void* LIBATRAC9_API Atrac9GetMixBus(int channelCount, int frameSamples);
+void LIBATRAC9_API Atrac9ReleaseMixBus(void* bus);
+int LIBATRAC9_API Atrac9MixBusDecode(void* bus, void* handle, const unsigned char *pAtrac9Buffer, const float *pGains, int *pNBytesUsed);
+int LIBATRAC9_API Atrac9MixBusRender(void* bus, short *pPcmBuffer);
+
 int LIBATRAC9_API Atrac9DecodeBuffer(void* at9Buffer, int at9BufferSize, void** outputBuffer, int *outputSize, int* wfxFormatOffset, int* dataOffset);
 void LIBATRAC9_API Atrac9FreeBuffer(void* buffer);
 
@@ -0,0 +1,74 @@
+#include "mdct_tables.h"
+#include "tables.h"
+#include "utility.h"
+#include <math.h>
+
+static void GenerateTrigTables(int sizeBits);
+static void GenerateShuffleTable(int sizeBits);
+static void GenerateMdctWindow(int frameSizePower);
+static void GenerateImdctWindow(int frameSizePower);
+
+void InitMdctTables()
+{
+	for (int i = 0; i < 9; i++)
+	{
+		GenerateTrigTables(i);
+		GenerateShuffleTable(i);
+	}
+
+	for (int i = 6; i <= 8; i++)
+	{
+		GenerateMdctWindow(i);
+		GenerateImdctWindow(i);
+	}
+}
+
+static void GenerateTrigTables(int sizeBits)
+{
+	const int size = 1 << sizeBits;
+	double* sinTab = SinTables[sizeBits];
+	double* cosTab = CosTables[sizeBits];
+
+	for (int i = 0; i < size; i++)
+	{
+		const double value = M_PI * (4 * i + 1) / (4 * size);
+		sinTab[i] = sin(value);
+		cosTab[i] = cos(value);
+	}
+}
+
+static void GenerateShuffleTable(int sizeBits)
+{
+	const int size = 1 << sizeBits;
+	int* table = ShuffleTables[sizeBits];
+	int* inverse = InverseShuffleTables[sizeBits];
+
+	for (int i = 0; i < size; i++)
+	{
+		table[i] = BitReverse32(i ^ (i / 2), sizeBits);
+		inverse[table[i]] = i;
+	}
+}
+
+static void GenerateMdctWindow(int frameSizePower)
+{
+	const int frameSize = 1 << frameSizePower;
+	double* mdct = MdctWindow[frameSizePower - 6];
+
+	for (int i = 0; i < frameSize; i++)
+	{
+		mdct[i] = (sin(((i + 0.5) / frameSize - 0.5) * M_PI) + 1.0) * 0.5;
+	}
+}
+
+static void GenerateImdctWindow(int frameSizePower)
+{
+	const int frameSize = 1 << frameSizePower;
+	double* imdct = ImdctWindow[frameSizePower - 6];
+	double* mdct = MdctWindow[frameSizePower - 6];
+
+	for (int i = 0; i < frameSize; i++)
+	{
+		imdct[i] = mdct[i] / (mdct[frameSize - 1 - i] * mdct[frameSize - 1 - i] + mdct[i] * mdct[i]);
+	}
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Builds the trig, shuffle and window tables used by the transforms
+void InitMdctTables();
@@ -0,0 +1,88 @@
+#include "mix_bus.h"
+#include "decoder.h"
+#include "dispatch.h"
+#include "imdct.h"
+#include "utility.h"
+#include <string.h>
+
+At9Status InitMixBus(MixBus* bus, int channelCount, int frameSamples)
+{
+	int frameSamplesPower;
+
+	switch (frameSamples)
+	{
+	case 64:
+		frameSamplesPower = 6;
+		break;
+	case 128:
+		frameSamplesPower = 7;
+		break;
+	case 256:
+		frameSamplesPower = 8;
+		break;
+	default:
+		return ERR_MIX_BUS_FORMAT_INVALID;
+	}
+
+	if (channelCount < 1 || channelCount > MAX_CHANNEL_COUNT)
+	{
+		return ERR_MIX_BUS_FORMAT_INVALID;
+	}
+
+	memset(bus, 0, sizeof(MixBus));
+	bus->ChannelCount = channelCount;
+	bus->FrameSamplesPower = frameSamplesPower;
+	bus->FrameSamples = frameSamples;
+
+	for (int i = 0; i < channelCount; i++)
+	{
+		bus->Channels[i].Mdct.Bits = frameSamplesPower;
+	}
+
+	return ERR_SUCCESS;
+}
+
+// Every voice on the bus uses the same window and transform size, so the
+// voices can be summed in the frequency domain and synthesized together.
+At9Status MixBusAddVoice(MixBus* bus, Atrac9Handle* handle, const unsigned char* audio, const float* gains, int* bytesUsed)
+{
+	if (handle->Config.FrameSamples != bus->FrameSamples || handle->OutputChannelCount != bus->ChannelCount)
+	{
+		return ERR_MIX_BUS_FORMAT_MISMATCH;
+	}
+
+	ERROR_CHECK(DecodeSpectra(handle, audio, bytesUsed));
+
+	for (int ch = 0; ch < bus->ChannelCount; ch++)
+	{
+		const double gain = gains[ch];
+		const double* voice = handle->OutputSpectra[ch];
+		const int voiceEnd = *handle->OutputSpectraEnd[ch];
+		MixBusChannel* channel = &bus->Channels[ch];
+		if (gain == 0) continue;
+
+		for (int i = 0; i < voiceEnd; i++)
+		{
+			channel->Spectra[i] += voice[i] * gain;
+		}
+		channel->SpectraEnd = Max(channel->SpectraEnd, voiceEnd);
+	}
+
+	return ERR_SUCCESS;
+}
+
+void MixBusRender(MixBus* bus, short* pcmOut)
+{
+	double* pcm[MAX_CHANNEL_COUNT];
+
+	for (int ch = 0; ch < bus->ChannelCount; ch++)
+	{
+		MixBusChannel* channel = &bus->Channels[ch];
+		RunImdct(&channel->Mdct, channel->Spectra, channel->SpectraEnd, channel->Pcm);
+		memset(channel->Spectra, 0, channel->SpectraEnd * sizeof(double));
+		channel->SpectraEnd = 0;
+		pcm[ch] = channel->Pcm;
+	}
+
+	Kernels.PcmFloatToShort(pcm, bus->ChannelCount, bus->FrameSamples, pcmOut);
+}
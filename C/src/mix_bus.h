@@ -0,0 +1,8 @@
+#pragma once
+
+#include "error_codes.h"
+#include "structures.h"
+
+At9Status InitMixBus(MixBus* bus, int channelCount, int frameSamples);
+At9Status MixBusAddVoice(MixBus* bus, Atrac9Handle* handle, const unsigned char* audio, const float* gains, int* bytesUsed);
+void MixBusRender(MixBus* bus, short* pcmOut);
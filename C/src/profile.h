@@ -0,0 +1,52 @@
+#pragma once
+
+#include "structures.h"
+
+// Building with ATRAC9_PROFILE adds a cycle and call count per decoding
+// stage to each handle. Without it the macros compile to nothing.
+// Each stage counts one call per decoded frame, so cycles / calls is the
+// stage's cost per frame however many pieces it was timed in.
+#ifdef ATRAC9_PROFILE
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define ProfileTicks() __rdtsc()
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#include <intrin.h>
+#define ProfileTicks() ((uint64_t)_ReadStatusReg(ARM64_CNTVCT))
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define ProfileTicks() __rdtsc()
+#elif defined(__aarch64__)
+static inline uint64_t ProfileTicks(void)
+{
+	uint64_t ticks;
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+	return ticks;
+}
+#else
+#include <time.h>
+#define ProfileTicks() ((uint64_t)clock())
+#endif
+
+#define PROFILE_START(start) const uint64_t start = ProfileTicks()
+#define PROFILE_STOP(profile, stage, start) AddProfileSample(profile, stage, ProfileTicks() - (start))
+// For stages timed in several pieces per frame: the pieces only add their
+// cycles, and the frame's call is counted once with PROFILE_COUNT
+#define PROFILE_ACCUMULATE(profile, stage, start) ((profile)->Stages[stage].Cycles += ProfileTicks() - (start))
+#define PROFILE_COUNT(profile, stage) ((profile)->Stages[stage].Calls++)
+
+static inline void AddProfileSample(ProfileStats* profile, ProfileStage stage, uint64_t ticks)
+{
+	profile->Stages[stage].Cycles += ticks;
+	profile->Stages[stage].Calls++;
+}
+
+#else
+
+#define PROFILE_START(start) do {} while (0)
+#define PROFILE_STOP(profile, stage, start) ((void)(profile))
+#define PROFILE_ACCUMULATE(profile, stage, start) ((void)(profile))
+#define PROFILE_COUNT(profile, stage) ((void)(profile))
+
+#endif
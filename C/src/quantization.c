@@ -1,57 +1,130 @@
 #include "quantization.h"
+#include "dispatch.h"
 #include "tables.h"
+#include "utility.h"
 #include <string.h>
 
-static void DequantizeQuantUnit(Channel* channel, int band);
-static void ScaleSpectrumChannel(Channel* channel);
+static void DequantizeStereoUnits(Channel* channel);
+static void DequantizeQuantUnitFixed(const Channel* source, int* spectra, int band, int scaleFactor, int negate);
 
-void DequantizeSpectra(Block* block)
+// Dequantizes and scales the spectrum in one pass. Intensity stereo units
+// are rebuilt from the primary channel's quantized values and this
+// channel's scale factors, so channels don't depend on each other.
+void DequantizeSpectra(Channel* channel)
 {
-	for (int i = 0; i < block->ChannelCount; i++)
+	for (int i = 0; i < channel->CodedQuantUnits; i++)
 	{
-		Channel* channel = &block->Channels[i];
-		memset(channel->Spectra, 0, sizeof(channel->Spectra));
+		Kernels.DequantizeQuantUnit(channel, channel->Spectra, i, SpectrumScale[channel->ScaleFactors[i]]);
+	}
+
+	DequantizeStereoUnits(channel);
+}
 
-		for (int j = 0; j < channel->CodedQuantUnits; j++)
+// Same as DequantizeSpectra on each channel, with the coded units run one
+// unit at a time across all of the channels. The channels are reordered.
+void DequantizeSpectraLockstep(Channel** channels, int channelCount)
+{
+	int count = channelCount;
+
+	// Sorted by coded unit count, the channels that code a unit come first
+	for (int i = 1; i < channelCount; i++)
+	{
+		Channel* channel = channels[i];
+		int j = i;
+		for (; j > 0 && channels[j - 1]->CodedQuantUnits < channel->CodedQuantUnits; j--)
 		{
-			DequantizeQuantUnit(channel, j);
+			channels[j] = channels[j - 1];
 		}
+		channels[j] = channel;
+	}
+
+	for (int i = 0; ; i++)
+	{
+		while (count > 0 && channels[count - 1]->CodedQuantUnits <= i) count--;
+		if (count == 0) break;
+
+		Kernels.DequantizeQuantUnits(channels, count, i);
+	}
+
+	for (int i = 0; i < channelCount; i++)
+	{
+		DequantizeStereoUnits(channels[i]);
 	}
 }
 
-static void DequantizeQuantUnit(Channel* channel, int band)
+// Fills in the units past the coded ones and clears the rest of the spectrum
+static void DequantizeStereoUnits(Channel* channel)
 {
-	const int subBandIndex = QuantUnitToCoeffIndex[band];
-	const int subBandCount = QuantUnitToCoeffCount[band];
-	const double stepSize = QuantizerStepSize[channel->Precisions[band]];
-	const double stepSizeFine = QuantizerFineStepSize[channel->PrecisionsFine[band]];
+	Block* block = channel->Block;
+	int endUnit = channel->CodedQuantUnits;
 
-	for (int sb = 0; sb < subBandCount; sb++)
+	if (block->BlockType == Stereo && channel->ChannelIndex != block->PrimaryChannelIndex)
+	{
+		const Channel* source = &block->Channels[block->PrimaryChannelIndex];
+		endUnit = block->QuantizationUnitCount;
+
+		for (int i = block->StereoQuantizationUnit; i < endUnit; i++)
+		{
+			const double scale = SpectrumScale[channel->ScaleFactors[i]];
+			Kernels.DequantizeQuantUnit(source, channel->Spectra, i, block->JointStereoSigns[i] > 0 ? -scale : scale);
+		}
+	}
+
+	// Everything below endBin was just written, so only clear what's left from the last frame
+	const int endBin = QuantUnitToCoeffIndex[endUnit];
+	if (channel->SpectraEnd > endBin)
 	{
-		const double coarse = channel->QuantizedSpectra[subBandIndex + sb] * stepSize;
-		const double fine = channel->QuantizedSpectraFine[subBandIndex + sb] * stepSizeFine;
-		channel->Spectra[subBandIndex + sb] = coarse + fine;
+		memset(&channel->Spectra[endBin], 0, (channel->SpectraEnd - endBin) * sizeof(double));
 	}
+	channel->SpectraEnd = endBin;
 }
 
-void ScaleSpectrumBlock(Block* block)
- {
-	 for (int i = 0; i < block->ChannelCount; i++)
-	 {
-		 ScaleSpectrumChannel(&block->Channels[i]);
-	 }
- }
+// Same as DequantizeSpectra, writing FixedSpectra
+void DequantizeSpectraFixed(Channel* channel)
+{
+	Block* block = channel->Block;
+	const int codedUnits = channel->CodedQuantUnits;
+	int endUnit = codedUnits;
+
+	for (int i = 0; i < codedUnits; i++)
+	{
+		DequantizeQuantUnitFixed(channel, channel->FixedSpectra, i, channel->ScaleFactors[i], FALSE);
+	}
+
+	if (block->BlockType == Stereo && channel->ChannelIndex != block->PrimaryChannelIndex)
+	{
+		const Channel* source = &block->Channels[block->PrimaryChannelIndex];
+		endUnit = block->QuantizationUnitCount;
 
-static void ScaleSpectrumChannel(Channel* channel)
+		for (int i = block->StereoQuantizationUnit; i < endUnit; i++)
+		{
+			DequantizeQuantUnitFixed(source, channel->FixedSpectra, i, channel->ScaleFactors[i], block->JointStereoSigns[i] > 0);
+		}
+	}
+
+	const int endBin = QuantUnitToCoeffIndex[endUnit];
+	if (channel->SpectraEnd > endBin)
+	{
+		memset(&channel->FixedSpectra[endBin], 0, (channel->SpectraEnd - endBin) * sizeof(int));
+	}
+	channel->SpectraEnd = endBin;
+}
+
+// Every SpectrumScale entry is 2^(scaleFactor - 15), so the scaling is
+// folded into the shift from the step size format down to samples
+static void DequantizeQuantUnitFixed(const Channel* source, int* spectra, int band, int scaleFactor, int negate)
 {
-	 const int quantUnitCount = channel->Block->QuantizationUnitCount;
-	 double* spectra = channel->Spectra;
-
-	 for (int i = 0; i < quantUnitCount; i++)
-	 {
-		 for (int sb = QuantUnitToCoeffIndex[i]; sb < QuantUnitToCoeffIndex[i + 1]; sb++)
-		 {
-			 spectra[sb] *= SpectrumScale[channel->ScaleFactors[i]];
-		 }
-	 }
- }
\ No newline at end of file
+	const int subBandIndex = QuantUnitToCoeffIndex[band];
+	const int subBandCount = QuantUnitToCoeffCount[band];
+	const int64_t stepSize = FixedQuantizerStepSize[source->Precisions[band]];
+	const int64_t stepSizeFine = FixedQuantizerFineStepSize[source->PrecisionsFine[band]];
+	const int shift = FIXED_STEP_BITS - FIXED_SAMPLE_BITS + 15 - scaleFactor;
+
+	for (int sb = 0; sb < subBandCount; sb++)
+	{
+		const int64_t coarse = source->QuantizedSpectra[subBandIndex + sb] * stepSize;
+		const int64_t fine = source->QuantizedSpectraFine[subBandIndex + sb] * stepSizeFine;
+		const int64_t value = negate ? -(coarse + fine) : coarse + fine;
+		spectra[subBandIndex + sb] = Saturate32(RoundShift64(value, shift));
+	}
+}
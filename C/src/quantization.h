@@ -2,5 +2,6 @@
 
 #include "structures.h"
 
-void DequantizeSpectra(Block* block);
-void ScaleSpectrumBlock(Block* block);
+void DequantizeSpectra(Channel* channel);
+void DequantizeSpectraLockstep(Channel** channels, int channelCount);
+void DequantizeSpectraFixed(Channel* channel);
@@ -54,12 +54,16 @@ At9Status ReadScaleFactors(Channel * channel, BitReaderCxt * br)
 		}
 	}
 
+	// Checked without an early exit so the loop can be vectorized
+	int outOfRange = 0;
 	for (int i = 0; i < channel->Block->ExtensionUnit; i++)
 	{
-		if (channel->ScaleFactors[i] < 0 || channel->ScaleFactors[i] > 31)
-		{
-			return ERR_UNPACK_SCALE_FACTOR_OOB;
-		}
+		outOfRange |= (unsigned int)channel->ScaleFactors[i] > 31;
+	}
+
+	if (outOfRange)
+	{
+		return ERR_UNPACK_SCALE_FACTOR_OOB;
 	}
 
 	memcpy(channel->ScaleFactorsPrev, channel->ScaleFactors, sizeof(channel->ScaleFactors));
@@ -74,9 +78,11 @@ static void ReadClcOffset(Channel* channel, BitReaderCxt* br)
 	const int bitLength = ReadInt(br, 2) + 2;
 	const int baseValue = bitLength < maxBits ? ReadInt(br, maxBits) : 0;
 
+	ReadInts(br, bitLength, channel->Block->ExtensionUnit, sf);
+
 	for (int i = 0; i < channel->Block->ExtensionUnit; i++)
 	{
-		sf[i] = ReadInt(br, bitLength) + baseValue;
+		sf[i] += baseValue;
 	}
 }
 
@@ -91,11 +97,11 @@ static void ReadVlcDeltaOffset(Channel* channel, BitReaderCxt* br)
 	const HuffmanCodebook* codebook = &HuffmanScaleFactorsUnsigned[bitLength];
 
 	sf[0] = ReadInt(br, bitLength);
+	ReadHuffmanValues(codebook, HuffmanScaleFactorsUnsignedMulti[bitLength], br, FALSE, channel->Block->ExtensionUnit - 1, &sf[1]);
 
 	for (int i = 1; i < channel->Block->ExtensionUnit; i++)
 	{
-		const int delta = ReadHuffmanValue(codebook, br, 0);
-		sf[i] = (sf[i - 1] + delta) & (codebook->ValueMax - 1);
+		sf[i] = (sf[i - 1] + sf[i]) & (codebook->ValueMax - 1);
 	}
 
 	for (int i = 0; i < channel->Block->ExtensionUnit; i++)
@@ -111,16 +117,14 @@ static void ReadVlcDistanceToBaseline(Channel* channel, BitReaderCxt* br, const
 	const HuffmanCodebook* codebook = &HuffmanScaleFactorsSigned[bitLength];
 	const int unitCount = Min(channel->Block->ExtensionUnit, baselineLength);
 
+	ReadHuffmanValues(codebook, HuffmanScaleFactorsSignedMulti[bitLength], br, TRUE, unitCount, sf);
+
 	for (int i = 0; i < unitCount; i++)
 	{
-		const int distance = ReadHuffmanValue(codebook, br, TRUE);
-		sf[i] = (baseline[i] + distance) & 31;
+		sf[i] = (baseline[i] + sf[i]) & 31;
 	}
 
-	for (int i = unitCount; i < channel->Block->ExtensionUnit; i++)
-	{
-		sf[i] = ReadInt(br, 5);
-	}
+	ReadInts(br, 5, channel->Block->ExtensionUnit - unitCount, &sf[unitCount]);
 }
 
 static void ReadVlcDeltaOffsetWithBaseline(Channel* channel, BitReaderCxt* br, const int* baseline, const int baselineLength)
@@ -132,11 +136,11 @@ static void ReadVlcDeltaOffsetWithBaseline(Channel* channel, BitReaderCxt* br, c
 	const int unitCount = Min(channel->Block->ExtensionUnit, baselineLength);
 
 	sf[0] = ReadInt(br, bitLength);
+	ReadHuffmanValues(codebook, HuffmanScaleFactorsUnsignedMulti[bitLength], br, FALSE, unitCount - 1, &sf[1]);
 
 	for (int i = 1; i < unitCount; i++)
 	{
-		const int delta = ReadHuffmanValue(codebook, br, FALSE);
-		sf[i] = (sf[i - 1] + delta) & (codebook->ValueMax - 1);
+		sf[i] = (sf[i - 1] + sf[i]) & (codebook->ValueMax - 1);
 	}
 
 	for (int i = 0; i < unitCount; i++)
@@ -144,8 +148,5 @@ static void ReadVlcDeltaOffsetWithBaseline(Channel* channel, BitReaderCxt* br, c
 		sf[i] += baseValue + baseline[i];
 	}
 
-	for (int i = unitCount; i < channel->Block->ExtensionUnit; i++)
-	{
-		sf[i] = ReadInt(br, 5);
-	}
+	ReadInts(br, 5, channel->Block->ExtensionUnit - unitCount, &sf[unitCount]);
 }
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <stdint.h>
+
 #define CONFIG_DATA_SIZE 4
 #define MAX_CHANNEL_COUNT 8
 #define MAX_BLOCK_COUNT 5
 #define MAX_BLOCK_CHANNEL_COUNT 2
 #define MAX_FRAME_SAMPLES 256
 #define MAX_BEX_VALUES 4
+#define MAX_DOWNMIX_CHANNELS 2
+#define IMDCT_BATCH_SIZE 8
 
 #define MAX_QUANT_UNITS 30
 
@@ -55,21 +59,60 @@ typedef struct {
 	int Size;
 	double Scale;
 	double ImdctPrevious[MAX_FRAME_SAMPLES];
+	int FixedImdctPrevious[MAX_FRAME_SAMPLES];
 	double* Window;
 	double* SinTable;
 	double* CosTable;
 } Mdct;
 
+// A set of same-sized transforms that are run together, one SIMD lane each
+typedef struct {
+	int Count;
+	int Bits;
+	int SparsePairs;
+	Mdct* Mdct[IMDCT_BATCH_SIZE];
+	double* Output[IMDCT_BATCH_SIZE];
+	double Data[MAX_FRAME_SAMPLES][IMDCT_BATCH_SIZE];
+} ImdctBatch;
+
+typedef struct {
+	int Valid;
+	int StartUnit;
+	int StartValue;
+	int EndUnit;
+	int EndValue;
+	int QuantizationUnitCount;
+} GradientKey;
+
+// Everything a channel's bit allocation is calculated from. Stationary
+// content often repeats it from frame to frame.
+typedef struct {
+	int Valid;
+	int GradientMode;
+	int GradientStartUnit;
+	int GradientStartValue;
+	int GradientEndUnit;
+	int GradientEndValue;
+	int GradientBoundary;
+	int QuantizationUnitCount;
+	int CodedQuantUnits;
+	int ScaleFactors[31];
+} AllocationKey;
+
 typedef struct {
 	Frame* Frame;
 	Block* Block;
 	ConfigData* Config;
 	int ChannelIndex;
+	int Enabled;
 
 	Mdct Mdct;
 
 	double Pcm[MAX_FRAME_SAMPLES];
 	double Spectra[MAX_FRAME_SAMPLES];
+	int SpectraEnd;
+	int FixedPcm[MAX_FRAME_SAMPLES];
+	int FixedSpectra[MAX_FRAME_SAMPLES];
 
 	int CodedQuantUnits;
 	int ScaleFactorCodingMode;
@@ -77,14 +120,19 @@ typedef struct {
 	int ScaleFactors[31];
 	int ScaleFactorsPrev[31];
 
-	int Precisions[MAX_QUANT_UNITS];
-	int PrecisionsFine[MAX_QUANT_UNITS];
-	int PrecisionMask[MAX_QUANT_UNITS];
-
-	int CodebookSet[MAX_QUANT_UNITS];
+	// Per-unit values are at most 15 and quantized values at most 16 bits,
+	// so narrow types keep the unpacked frame small
+	unsigned char Precisions[MAX_QUANT_UNITS];
+	unsigned char PrecisionsFine[MAX_QUANT_UNITS];
+	unsigned char PrecisionMask[MAX_QUANT_UNITS];
+	unsigned char CodebookSet[MAX_QUANT_UNITS];
+	AllocationKey AllocationKey;
 
-	int QuantizedSpectra[MAX_FRAME_SAMPLES];
-	int QuantizedSpectraFine[MAX_FRAME_SAMPLES];
+	short QuantizedSpectra[MAX_FRAME_SAMPLES];
+	short QuantizedSpectraFine[MAX_FRAME_SAMPLES];
+	int QuantizedSpectraEnd;
+	int QuantizedSpectraFineEnd;
+	int Silent;
 
 	int BexMode;
 	int BexValueCount;
@@ -102,6 +150,7 @@ struct Block {
 	int ChannelCount;
 	int FirstInSuperframe;
 	int ReuseBandParams;
+	int BitCount;
 
 	int BandCount;
 	int StereoBand;
@@ -111,6 +160,7 @@ struct Block {
 	int ExtensionUnit;
 	int QuantizationUnitsPrev;
 
+	GradientKey GradientKey;
 	int Gradient[31];
 	int GradientMode;
 	int GradientStartUnit;
@@ -127,24 +177,95 @@ struct Block {
 	int HasExtensionData;
 	int BexDataLength;
 	int BexMode;
+	int Silent;
 };
 
 struct Frame {
 	int IndexInSuperframe;
+	int Silent;
 	ConfigData* Config;
 	Channel* Channels[MAX_CHANNEL_COUNT];
 	Block Blocks[MAX_BLOCK_COUNT];
 };
 
+// Intensity stereo and the scale factors are applied inside DequantizeSpectra,
+// so they are counted as part of it. Imdct includes queueing into the batch.
+typedef enum {
+	ProfileUnpackFrame,
+	ProfileDequantizeSpectra,
+	ProfileBandExtension,
+	ProfileImdct,
+	ProfilePcmToShort,
+	ProfileStageCount
+} ProfileStage;
+
+typedef struct {
+	uint64_t Cycles;
+	uint64_t Calls;
+} ProfileCounter;
+
+typedef struct {
+	ProfileCounter Stages[ProfileStageCount];
+} ProfileStats;
+
+// Counts of the coding tools used by the frames a handle has unpacked.
+// Block fields are indexed by the block's position in the channel config.
+typedef struct {
+	uint64_t Frames;
+	uint64_t BlockBits[MAX_BLOCK_COUNT];
+	uint64_t StandardBlocks;
+	uint64_t ReusedBandParams;
+	uint64_t GradientModes[4];
+	uint64_t StereoBlocks;
+	uint64_t IntensityStereoBlocks;
+	uint64_t IntensityStereoUnits;
+	uint64_t JointStereoSignBlocks;
+	uint64_t BandExtensionBlocks;
+	uint64_t BexModes[5];
+	uint64_t ScaleFactorModes[MAX_BLOCK_CHANNEL_COUNT][4];
+} StreamStats;
+
+typedef struct {
+	Mdct Mdct;
+	double Gains[MAX_CHANNEL_COUNT];
+	double Spectra[MAX_FRAME_SAMPLES];
+	int SpectraEnd;
+	double Pcm[MAX_FRAME_SAMPLES];
+} DownmixChannel;
+
 typedef struct {
 	int Initialized;
 	int Wlength;
 	ConfigData Config;
 	Frame Frame;
-    double MdctWindow[3][256];
-    double ImdctWindow[3][256];
+	int ChannelMask;
+	int DownmixChannelCount;
+	DownmixChannel Downmix[MAX_DOWNMIX_CHANNELS];
+	int FixedPoint;
+	int OutputChannelCount;
+	Mdct* OutputMdct[MAX_CHANNEL_COUNT];
+	double* OutputSpectra[MAX_CHANNEL_COUNT];
+	int* OutputSpectraEnd[MAX_CHANNEL_COUNT];
+	double* OutputPcm[MAX_CHANNEL_COUNT];
+	int* OutputFixedPcm[MAX_CHANNEL_COUNT];
+	ProfileStats Profile;
+	StreamStats Stats;
 } Atrac9Handle;
 
+typedef struct {
+	Mdct Mdct;
+	double Spectra[MAX_FRAME_SAMPLES];
+	int SpectraEnd;
+	double Pcm[MAX_FRAME_SAMPLES];
+} MixBusChannel;
+
+typedef struct {
+	int ChannelCount;
+	int FrameSamplesPower;
+	int FrameSamples;
+	MixBusChannel Channels[MAX_CHANNEL_COUNT];
+} MixBus;
+
 typedef struct {
 	char GroupBUnit;
 	char GroupCUnit;
@@ -1,10 +1,17 @@
 #include "tables.h"
 
-//double MdctWindow[3][256];
-//double ImdctWindow[3][256];
+double MdctWindow[3][256];
+double ImdctWindow[3][256];
 double SinTables[9][256];
 double CosTables[9][256];
 int ShuffleTables[9][256];
+int InverseShuffleTables[9][256];
+
+int64_t FixedQuantizerStepSize[16];
+int64_t FixedQuantizerFineStepSize[16];
+int FixedImdctWindow[3][256];
+int FixedSinTables[9][256];
+int FixedCosTables[9][256];
 
 const ChannelConfig ChannelConfigs[6] =
 {
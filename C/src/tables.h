@@ -1,6 +1,15 @@
 #pragma once
 
 #include "structures.h"
+#include <stdint.h>
+
+// Fixed-point synthesis formats. Spectra and PCM are in 16-bit sample
+// units with FIXED_SAMPLE_BITS fractional bits.
+#define FIXED_SAMPLE_BITS 8
+#define FIXED_STEP_BITS 46
+#define FIXED_SCALE_BITS 24
+#define FIXED_TRIG_BITS 30
+#define FIXED_WINDOW_BITS 29
 
 extern const ChannelConfig ChannelConfigs[6];
 extern const unsigned char MaxHuffPrecision[2];
@@ -19,8 +28,15 @@ extern const double QuantizerInverseStepSize[16];
 extern const double QuantizerStepSize[16];
 extern const double QuantizerFineStepSize[16];
 
-//extern double MdctWindow[3][256];
-//extern double ImdctWindow[3][256];
+extern double MdctWindow[3][256];
+extern double ImdctWindow[3][256];
 extern double SinTables[9][256];
 extern double CosTables[9][256];
 extern int ShuffleTables[9][256];
+extern int InverseShuffleTables[9][256];
+
+extern int64_t FixedQuantizerStepSize[16];
+extern int64_t FixedQuantizerFineStepSize[16];
+extern int FixedImdctWindow[3][256];
+extern int FixedSinTables[9][256];
+extern int FixedCosTables[9][256];
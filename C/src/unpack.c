@@ -17,7 +17,6 @@ static At9Status ReadExtensionParams(Block* block, BitReaderCxt* br);
 static void UpdateCodedUnits(Channel* channel);
 static void CalculateSpectrumCodebookIndex(Channel* channel);
 
-static At9Status ReadSpectra(Channel* channel, BitReaderCxt* br);
 static At9Status ReadSpectraFine(Channel* channel, BitReaderCxt* br);
 
 static At9Status UnpackLfeBlock(Block* block, BitReaderCxt* br);
@@ -25,6 +24,9 @@ static void DecodeLfeScaleFactors(Channel* channel, BitReaderCxt* br);
 static void CalculateLfePrecision(Channel* channel);
 static void ReadLfeSpectra(Channel* channel, BitReaderCxt* br);
 
+static void UpdateBlockSilence(Block* block);
+static void ClearQuantizedSpectraTail(Channel* channel);
+
 At9Status UnpackFrame(Frame* frame, BitReaderCxt* br)
 {
 	const int blockCount = frame->Config->ChannelConfig.BlockCount;
@@ -49,8 +51,49 @@ At9Status UnpackFrame(Frame* frame, BitReaderCxt* br)
 	return ERR_SUCCESS;
 }
 
+// Only reads what UnpackFrame already stored, so it costs a few adds per block
+void RecordStreamStats(const Frame* frame, StreamStats* stats)
+{
+	stats->Frames++;
+
+	for (int i = 0; i < frame->Config->ChannelConfig.BlockCount; i++)
+	{
+		const Block* block = &frame->Blocks[i];
+		stats->BlockBits[i] += block->BitCount;
+		if (block->BlockType == LFE) continue;
+
+		stats->StandardBlocks++;
+		stats->ReusedBandParams += block->ReuseBandParams;
+		stats->GradientModes[block->GradientMode]++;
+
+		if (block->BlockType == Stereo)
+		{
+			const int intensityUnits = block->QuantizationUnitCount - block->StereoQuantizationUnit;
+			stats->StereoBlocks++;
+			stats->IntensityStereoBlocks += intensityUnits > 0;
+			stats->IntensityStereoUnits += intensityUnits;
+			stats->JointStereoSignBlocks += block->HasJointStereoSigns;
+		}
+
+		if (block->BandExtensionEnabled)
+		{
+			stats->BandExtensionBlocks++;
+			if (block->HasExtensionData)
+			{
+				stats->BexModes[block->Channels[0].BexMode]++;
+			}
+		}
+
+		for (int c = 0; c < block->ChannelCount; c++)
+		{
+			stats->ScaleFactorModes[c][block->Channels[c].ScaleFactorCodingMode]++;
+		}
+	}
+}
+
 static At9Status UnpackBlock(Block* block, BitReaderCxt* br)
 {
+	const int start = br->Position;
 	ERROR_CHECK(ReadBlockHeader(block, br));
 
 	if (block->BlockType == LFE)
@@ -63,6 +106,7 @@ static At9Status UnpackBlock(Block* block, BitReaderCxt* br)
 	}
 
 	AlignPosition(br, 8);
+	block->BitCount = br->Position - start;
 	return ERR_SUCCESS;
 }
 
@@ -97,15 +141,20 @@ static At9Status UnpackStandardBlock(Block* block, BitReaderCxt* br)
 		UpdateCodedUnits(channel);
 
 		ERROR_CHECK(ReadScaleFactors(channel, br));
-		CalculateMask(channel);
-		CalculatePrecisions(channel);
-		CalculateSpectrumCodebookIndex(channel);
+
+		if (AllocationChanged(channel))
+		{
+			CalculateMask(channel);
+			CalculatePrecisions(channel);
+			CalculateSpectrumCodebookIndex(channel);
+		}
 
 		ERROR_CHECK(ReadSpectra(channel, br));
 		ERROR_CHECK(ReadSpectraFine(channel, br));
 	}
 
 	block->QuantizationUnitsPrev = block->BandExtensionEnabled ? block->ExtensionUnit : block->QuantizationUnitCount;
+	UpdateBlockSilence(block);
 	return ERR_SUCCESS;
 }
 
@@ -186,7 +235,8 @@ static At9Status ReadGradientParams(Block* block, BitReaderCxt* br)
 	{
 		return ERR_UNPACK_GRAD_START_UNIT_OOB;
 	}
-	if (block->GradientEndUnit < 0 || block->GradientEndUnit >= 48)
+	// Block::Gradient ends at unit 31
+	if (block->GradientEndUnit < 0 || block->GradientEndUnit > 31)
 	{
 		return ERR_UNPACK_GRAD_END_UNIT_OOB;
 	}
@@ -353,10 +403,10 @@ static void CalculateSpectrumCodebookIndex(Channel* channel)
 	sf[quantUnits] = originalScaleTmp;
 }
 
-static At9Status ReadSpectra(Channel* channel, BitReaderCxt* br)
+At9Status ReadSpectra(Channel* channel, BitReaderCxt* br)
 {
 	int values[16];
-	memset(channel->QuantizedSpectra, 0, sizeof(channel->QuantizedSpectra));
+	int nonZero = 0;
 	const int maxHuffPrecision = MaxHuffPrecision[channel->Config->HighSampleRate];
 
 	for (int i = 0; i < channel->CodedQuantUnits; i++)
@@ -370,6 +420,7 @@ static At9Status ReadSpectra(Channel* channel, BitReaderCxt* br)
 			for (int j = 0; j < groupCount; j++)
 			{
 				values[j] = ReadHuffmanValue(huff, br, FALSE);
+				nonZero |= values[j];
 			}
 
 			DecodeHuffmanValues(channel->QuantizedSpectra, QuantUnitToCoeffIndex[i], subbandCount, huff, values);
@@ -377,19 +428,24 @@ static At9Status ReadSpectra(Channel* channel, BitReaderCxt* br)
 		else
 		{
 			const int subbandIndex = QuantUnitToCoeffIndex[i];
-			for (int j = subbandIndex; j < QuantUnitToCoeffIndex[i + 1]; j++)
+			ReadSignedShorts(br, precision, subbandCount, &channel->QuantizedSpectra[subbandIndex]);
+			for (int j = subbandIndex; j < subbandIndex + subbandCount; j++)
 			{
-				channel->QuantizedSpectra[j] = ReadSignedInt(br, precision);
+				nonZero |= channel->QuantizedSpectra[j];
 			}
 		}
 	}
 
+	ClearQuantizedSpectraTail(channel);
+	channel->Silent = nonZero == 0;
 	return ERR_SUCCESS;
 }
 
 static At9Status ReadSpectraFine(Channel* channel, BitReaderCxt* br)
 {
-	memset(channel->QuantizedSpectraFine, 0, sizeof(channel->QuantizedSpectraFine));
+	int nonZero = 0;
+	memset(channel->QuantizedSpectraFine, 0, channel->QuantizedSpectraFineEnd * sizeof(short));
+	channel->QuantizedSpectraFineEnd = 0;
 
 	for (int i = 0; i < channel->CodedQuantUnits; i++)
 	{
@@ -399,12 +455,16 @@ static At9Status ReadSpectraFine(Channel* channel, BitReaderCxt* br)
 			const int startSubband = QuantUnitToCoeffIndex[i];
 			const int endSubband = QuantUnitToCoeffIndex[i + 1];
 
+			ReadSignedShorts(br, overflowBits, endSubband - startSubband, &channel->QuantizedSpectraFine[startSubband]);
 			for (int j = startSubband; j < endSubband; j++)
 			{
-				channel->QuantizedSpectraFine[j] = ReadSignedInt(br, overflowBits);
+				nonZero |= channel->QuantizedSpectraFine[j];
 			}
+			channel->QuantizedSpectraFineEnd = endSubband;
 		}
 	}
+
+	channel->Silent &= nonZero == 0;
 	return ERR_SUCCESS;
 }
 
@@ -417,6 +477,7 @@ static At9Status UnpackLfeBlock(Block* block, BitReaderCxt* br)
 	CalculateLfePrecision(channel);
 	channel->CodedQuantUnits = block->QuantizationUnitCount;
 	ReadLfeSpectra(channel, br);
+	UpdateBlockSilence(block);
 
 	return ERR_SUCCESS;
 }
@@ -443,16 +504,47 @@ static void CalculateLfePrecision(Channel* channel)
 
 static void ReadLfeSpectra(Channel* channel, BitReaderCxt* br)
 {
-	memset(channel->QuantizedSpectra, 0, sizeof(channel->QuantizedSpectra));
+	int nonZero = 0;
+	memset(channel->QuantizedSpectra, 0, channel->QuantizedSpectraEnd * sizeof(short));
+	channel->QuantizedSpectraEnd = 0;
 
 	for (int i = 0; i < channel->CodedQuantUnits; i++)
 	{
 		if (channel->Precisions[i] <= 0) continue;
 
 		const int precision = channel->Precisions[i] + 1;
+		ReadSignedShorts(br, precision, QuantUnitToCoeffCount[i], &channel->QuantizedSpectra[QuantUnitToCoeffIndex[i]]);
 		for (int j = QuantUnitToCoeffIndex[i]; j < QuantUnitToCoeffIndex[i + 1]; j++)
 		{
-			channel->QuantizedSpectra[j] = ReadSignedInt(br, precision);
+			nonZero |= channel->QuantizedSpectra[j];
 		}
+		channel->QuantizedSpectraEnd = QuantUnitToCoeffIndex[i + 1];
+	}
+
+	channel->Silent = nonZero == 0;
+}
+
+// Every coded quant unit is fully written, so only coefficients past
+// the coded units that were left over from the last frame need clearing.
+static void ClearQuantizedSpectraTail(Channel* channel)
+{
+	const int codedEnd = QuantUnitToCoeffIndex[channel->CodedQuantUnits];
+
+	if (channel->QuantizedSpectraEnd > codedEnd)
+	{
+		memset(&channel->QuantizedSpectra[codedEnd], 0, (channel->QuantizedSpectraEnd - codedEnd) * sizeof(short));
+	}
+	channel->QuantizedSpectraEnd = codedEnd;
+}
+
+// A block is silent when no channel has any coded coefficients and band
+// extension won't add any, so the whole spectrum is known to be zero.
+static void UpdateBlockSilence(Block* block)
+{
+	block->Silent = !(block->BandExtensionEnabled && block->HasExtensionData);
+
+	for (int i = 0; i < block->ChannelCount; i++)
+	{
+		block->Silent &= block->Channels[i].Silent;
 	}
 }
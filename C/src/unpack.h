@@ -5,3 +5,5 @@
 #include "structures.h"
 
 At9Status UnpackFrame(Frame* frame, BitReaderCxt* br);
+void RecordStreamStats(const Frame* frame, StreamStats* stats);
+At9Status ReadSpectra(Channel* channel, BitReaderCxt* br);
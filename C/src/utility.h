@@ -1,5 +1,8 @@
 #pragma once
 
+#include <limits.h>
+#include <stdint.h>
+
 #define FALSE 0
 #define TRUE 1
 
@@ -7,9 +10,46 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-int Max(int a, int b);
-int Min(int a, int b);
 unsigned int BitReverse32(unsigned int value, int bitCount);
-int SignExtend32(int value, int bits);
-short Clamp16(int value);
-int Round(double x);
+
+// The small helpers used in the inner loops are defined here so every file
+// can inline them, not just builds with link-time optimization
+
+static inline int Max(int a, int b) { return a > b ? a : b; }
+static inline int Min(int a, int b) { return a > b ? b : a; }
+
+static inline int SignExtend32(int value, int bits)
+{
+	const int shift = 8 * sizeof(int) - bits;
+	return (value << shift) >> shift;
+}
+
+static inline short Clamp16(int value)
+{
+	if (value > SHRT_MAX)
+		return SHRT_MAX;
+	if (value < SHRT_MIN)
+		return SHRT_MIN;
+	return (short)value;
+}
+
+static inline int Round(double x)
+{
+	x += 0.5;
+	return (int)x - (x < (int)x);
+}
+
+static inline int Saturate32(int64_t value)
+{
+	if (value > INT_MAX)
+		return INT_MAX;
+	if (value < INT_MIN)
+		return INT_MIN;
+	return (int)value;
+}
+
+// Rounds half up, like Round
+static inline int64_t RoundShift64(int64_t value, int shift)
+{
+	return (value + ((int64_t)1 << (shift - 1))) >> shift;
+}
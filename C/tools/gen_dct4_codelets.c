@@ -0,0 +1,118 @@
+// Writes src/dct4_codelets.h. Each codelet runs the butterfly stages of
+// Dct4 on one block of 64 or 128 values, with the loops unrolled, the
+// table values written out as hex float literals and the output shuffle
+// folded into the final stores as constant indices. Every step is the same
+// operation, in the same order, as in the Dct4 loop, so the results are
+// bit-identical. Run with "make codelets".
+#include "mdct_tables.h"
+#include "tables.h"
+#include <stdio.h>
+
+static void WriteCodelet(const char* name, int bits, int blockBits);
+static void WriteButterfly(int front, int back, double sin, double cos);
+
+int main(void)
+{
+	InitMdctTables();
+
+	printf("// Generated by tools/gen_dct4_codelets.c from the tables built by InitMdctTables.\n");
+	printf("// Don't edit this file; run \"make codelets\" instead.\n");
+	printf("#pragma once\n");
+
+	WriteCodelet("Dct4Stages64", 6, 6);
+	WriteCodelet("Dct4Stages128", 7, 7);
+	WriteCodelet("Dct4Stages256Half", 8, 7);
+
+	return 0;
+}
+
+// After its first stage, a transform of twice the size is two independent
+// blocks that go through the same stages with the same tables, so the 256
+// value transform runs its codelet once per block. The shuffle sends the
+// k-th output of the second block next to the k-th of the first, one index
+// up or down, so the codelet stores the first block's even and odd indices
+// through separate pointers, and the second call swaps them.
+static void WriteCodelet(const char* name, int bits, int blockBits)
+{
+	const int size = 1 << blockBits;
+	const int stageCount = blockBits - 1;
+	const int* inverseShuffle = InverseShuffleTables[bits];
+	const int halves = bits > blockBits;
+
+	if (halves)
+	{
+		printf("\nstatic void %s(const double* block, double* even, double* odd)\n{\n", name);
+	}
+	else
+	{
+		printf("\nstatic void %s(const double* block, double* output)\n{\n", name);
+	}
+
+	printf("\tdouble a, b;\n");
+	for (int i = 0; i < size; i += 16)
+	{
+		printf("\tdouble");
+		for (int k = i; k < i + 16; k++)
+		{
+			printf(" v%d%s", k, k == i + 15 ? ";\n" : ",");
+		}
+	}
+	printf("\n");
+
+	for (int i = 0; i < size; i++)
+	{
+		printf("\tv%d = block[%d];\n", i, i);
+	}
+
+	for (int stage = 0; stage < stageCount - 2; stage++)
+	{
+		const int blockCount = 1 << stage;
+		const int blockHalfSizeBits = stageCount - stage - 1;
+		const int blockSize = 1 << (stageCount - stage);
+		const int blockHalfSize = 1 << blockHalfSizeBits;
+
+		for (int block = 0; block < blockCount; block++)
+		{
+			for (int i = 0; i < blockHalfSize; i++)
+			{
+				const int frontPos = (block * blockSize + i) * 2;
+				WriteButterfly(frontPos, frontPos + blockSize, SinTables[blockHalfSizeBits][i], CosTables[blockHalfSizeBits][i]);
+			}
+		}
+	}
+
+	for (int group = 0; group < size; group += 8)
+	{
+		WriteButterfly(group, group + 4, SinTables[1][0], CosTables[1][0]);
+		WriteButterfly(group + 2, group + 6, SinTables[1][1], CosTables[1][1]);
+		WriteButterfly(group, group + 2, SinTables[0][0], CosTables[0][0]);
+		WriteButterfly(group + 4, group + 6, SinTables[0][0], CosTables[0][0]);
+
+		for (int k = 0; k < 8; k++)
+		{
+			const int index = inverseShuffle[group + k];
+
+			if (halves)
+			{
+				printf("\t%s[%d] = v%d;\n", index & 1 ? "odd" : "even", index & ~1, group + k);
+			}
+			else
+			{
+				printf("\toutput[%d] = v%d;\n", index, group + k);
+			}
+		}
+	}
+
+	printf("}\n");
+}
+
+// One butterfly of the Dct4 stage loop in kernels.c
+static void WriteButterfly(int front, int back, double sin, double cos)
+{
+	printf("\ta = v%d - v%d;\n", front, back);
+	printf("\tb = v%d - v%d;\n", front + 1, back + 1);
+	printf("\tv%d += v%d;\n", front, back);
+	printf("\tv%d += v%d;\n", front + 1, back + 1);
+	printf("\tv%d = a * %a + b * %a;\n", back, cos, sin);
+	printf("\tv%d = a * %a - b * %a;\n", back + 1, sin, cos);
+}